@@ -79,6 +79,21 @@ namespace Voxymore::Core
 		 * of the component.
 		 */
 		Vec3 Scale = Vec3(1.0f);
+
+		/**
+		 * @brief World matrix and normal matrix of the last position, rotation and scale.
+		 *
+		 * Rebuilt on the first read after a modification, so all the systems
+		 * reading the matrix during a frame share a single computation.
+		 */
+		mutable Mat4 m_CachedTransform = Math::Identity<Mat4>();
+		mutable Mat3 m_CachedNormalMatrix = Math::Identity<Mat3>();
+		mutable bool m_Dirty = true;
+
+		/**
+		 * @brief Incremented on each modification so the values derived from the transform can be cached by the other components.
+		 */
+		uint64_t m_Version = 0;
 	public:
 
 		inline TransformComponent() = default;
@@ -87,14 +102,14 @@ namespace Voxymore::Core
 		inline TransformComponent(const Vec3& position, const Vec3& rotation = Vec3(0,0,0), const Vec3& scale = Vec3(1.0f)) : Position(position), Rotation(glm::radians(rotation)), EulerRotation(rotation), Scale(scale) {}
 	public:
 		inline Vec3 GetPosition() const { return Position; }
-		inline void SetPosition(const Vec3& position) { Position = position; }
-		inline void AddMovement(const Vec3& movement) { Position += movement; }
+		inline void SetPosition(const Vec3& position) { Position = position; MarkDirty(); }
+		inline void AddMovement(const Vec3& movement) { Position += movement; MarkDirty(); }
 
 		inline Vec3 GetScale() const { return Scale; }
-		inline void SetScale(const Vec3& scale) { Scale = scale; }
+		inline void SetScale(const Vec3& scale) { Scale = scale; MarkDirty(); }
 
 		inline Quat GetRotation() const { return Rotation; }
-		inline void SetRotation(const Quat& rotation) {Rotation = rotation; EulerRotation = glm::degrees(glm::eulerAngles(rotation));}
+		inline void SetRotation(const Quat& rotation) {Rotation = rotation; EulerRotation = glm::degrees(glm::eulerAngles(rotation)); MarkDirty();}
 
 		/**
 		 * @brief : Get the Euler rotation of the transform component.
@@ -116,18 +131,47 @@ namespace Voxymore::Core
 		 * @param rotation: The new desired Euler rotation angles in degrees.
 		 * @return void
 		 */
-		inline void SetEulerRotation(const Vec3& rotation) {EulerRotation = rotation; Rotation = Quat(glm::radians(rotation)); }
+		inline void SetEulerRotation(const Vec3& rotation) {EulerRotation = rotation; Rotation = Quat(glm::radians(rotation)); MarkDirty(); }
 
 		inline Vec3 GetForward() const { VXM_PROFILE_FUNCTION(); return Rotation * Vec3{0,0,1}; }
 		inline Vec3 GetRight() const { VXM_PROFILE_FUNCTION(); return Rotation * Vec3{1,0,0}; }
 		inline Vec3 GetUp() const { VXM_PROFILE_FUNCTION(); return Rotation * Vec3{0,1,0}; }
 
-		inline Mat4 GetTransform() const
+		inline const Mat4& GetTransform() const
+		{
+			VXM_PROFILE_FUNCTION();
+			UpdateCache();
+			return m_CachedTransform;
+		}
+
+		/**
+		 * @brief The inverse transpose of the rotation and scale of the transform, to bring the normals in world space.
+		 */
+		inline const Mat3& GetNormalMatrix() const
 		{
 			VXM_PROFILE_FUNCTION();
-			return Math::TRS(Position, Rotation, Scale); // Translation * Rotation * Scale => TRS Matrix.
+			UpdateCache();
+			return m_CachedNormalMatrix;
 		}
-		inline Vec3 GetWorldPoint(const Vec3& localPoint) { VXM_PROFILE_FUNCTION(); return Math::TransformPoint(GetTransform(), localPoint); }
+
+		inline Vec3 GetWorldPoint(const Vec3& localPoint) const { VXM_PROFILE_FUNCTION(); return Math::TransformPoint(GetTransform(), localPoint); }
+
+		/**
+		 * @brief Rebuild the cached matrices now if the transform changed.
+		 * Must be called before reading the same transform from several threads.
+		 */
+		inline void UpdateCache() const
+		{
+			VXM_PROFILE_FUNCTION();
+			if(!m_Dirty) return;
+			m_CachedTransform = Math::TRS(Position, Rotation, Scale); // Translation * Rotation * Scale => TRS Matrix.
+			m_CachedNormalMatrix = glm::transpose(Math::Inverse(Mat3(m_CachedTransform)));
+			m_Dirty = false;
+		}
+
+		[[nodiscard]] inline uint64_t GetVersion() const { return m_Version; }
+	private:
+		inline void MarkDirty() { m_Dirty = true; ++m_Version; }
 
 	};
 
@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include "Voxymore/Core/BinaryStream.hpp"
 #include "Voxymore/Core/YamlHelper.hpp"
 #include "Voxymore/Scene/Entity.hpp"
+#include "Voxymore/Scene/Scene.hpp"
 #include <imgui.h>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <static_block.hpp>
 
@@ -27,6 +30,22 @@ public:
 		bool (*OnImGuizmo)(Entity/*sourceEntity*/, const float* viewMatrix, const float* projectionMatrix) = nullptr;
 		void (*AddComponent)(Entity);
 		void (*RemoveComponent)(Entity);
+		/**
+		 * Copy all the components of the source scene on the same entities of the target scene, nullptr if the component cannot be copied.
+		 */
+		void (*CloneComponents)(const Scene& /*sourceScene*/, Scene& /*targetScene*/) = nullptr;
+		/**
+		 * Binary counterpart of the YAML functions used by the runtime scene format, nullptr if the component didn't opt in.
+		 * The component is then stored in the runtime scene as YAML.
+		 */
+		void (*SerializeBinary)(BinaryWriter& /*writer*/, Entity /*sourceEntity*/) = nullptr;
+		void (*DeserializeBinary)(BinaryReader& /*reader*/, Entity /*targetEntity*/) = nullptr;
+		void (*ReserveComponents)(Scene& /*scene*/, size_t /*count*/);
+		/**
+		 * Whether DeserializeComponent only writes in its own component, without adding or removing any component.
+		 * The parallel scene loading then runs it on the worker threads. Components opt in with a `static constexpr bool ConcurrentDeserialization = true;`.
+		 */
+		bool ConcurrentDeserialization = false;
 	};
 
 	class ComponentManager
@@ -65,6 +84,12 @@ public:
 		inline static bool StaticOnImGuiRender(::Voxymore::Core::Entity sourceEntity) {return sourceEntity.GetComponent<T>().OnImGuiRender();}
 		inline static bool StaticOnImGuizmo(::Voxymore::Core::Entity sourceEntity, const float* viewMatrix, const float* projectionMatrix) {return sourceEntity.GetComponent<T>().OnImGuizmo(viewMatrix, projectionMatrix);}
 		inline static std::string StaticGetName() { return T::GetName(); }
+		inline static void StaticCloneComponents(const Scene& sourceScene, Scene& targetScene) { targetScene.CloneStorage<T>(sourceScene); }
+		inline static void StaticReserveComponents(Scene& scene, size_t count) { scene.ReserveStorage<T>(count); }
+		inline static void StaticSerializeBinary(BinaryWriter& writer, ::Voxymore::Core::Entity sourceEntity) {sourceEntity.GetComponent<T>().SerializeComponent(writer);}
+		inline static void StaticDeserializeBinary(BinaryReader& reader, ::Voxymore::Core::Entity targetEntity) {targetEntity.GetComponent<T>().DeserializeComponent(reader);}
+		static constexpr bool HasBinarySerialization() { return requires(T& t, BinaryWriter& writer, BinaryReader& reader) { t.SerializeComponent(writer); t.DeserializeComponent(reader); }; }
+		static constexpr bool HasConcurrentDeserialization() { if constexpr (requires { T::ConcurrentDeserialization; }) return T::ConcurrentDeserialization; else return false; }
 
 		inline static void RegisterComponent()
 		{
@@ -80,6 +105,14 @@ public:
 			cc.DeserializeComponent = T::StaticDeserializeComponent;
 			cc.OnImGuiRender = T::StaticOnImGuiRender;
 			cc.OnImGuizmo = T::StaticOnImGuizmo;
+			cc.ReserveComponents = T::StaticReserveComponents;
+			cc.ConcurrentDeserialization = HasConcurrentDeserialization();
+			if constexpr (std::is_copy_constructible_v<T>) cc.CloneComponents = T::StaticCloneComponents;
+			if constexpr (HasBinarySerialization())
+			{
+				cc.SerializeBinary = T::StaticSerializeBinary;
+				cc.DeserializeBinary = T::StaticDeserializeBinary;
+			}
 			ComponentManager::AddComponent(cc);
 		}
 
@@ -103,6 +136,12 @@ public:
 		inline static bool StaticOnImGuiRender(::Voxymore::Core::Entity sourceEntity) {return sourceEntity.GetComponent<T>().OnImGuiRender(sourceEntity);}
 		inline static bool StaticOnImGuizmo(::Voxymore::Core::Entity sourceEntity, const float* viewMatrix, const float* projectionMatrix) {return sourceEntity.GetComponent<T>().OnImGuizmo(sourceEntity, viewMatrix, projectionMatrix);}
 		inline static std::string StaticGetName() { return T::GetName(); }
+		inline static void StaticCloneComponents(const Scene& sourceScene, Scene& targetScene) { targetScene.CloneStorage<T>(sourceScene); }
+		inline static void StaticReserveComponents(Scene& scene, size_t count) { scene.ReserveStorage<T>(count); }
+		inline static void StaticSerializeBinary(BinaryWriter& writer, ::Voxymore::Core::Entity sourceEntity) {sourceEntity.GetComponent<T>().SerializeComponent(writer, sourceEntity);}
+		inline static void StaticDeserializeBinary(BinaryReader& reader, ::Voxymore::Core::Entity targetEntity) {targetEntity.GetComponent<T>().DeserializeComponent(reader, targetEntity);}
+		static constexpr bool HasBinarySerialization() { return requires(T& t, BinaryWriter& writer, BinaryReader& reader, ::Voxymore::Core::Entity e) { t.SerializeComponent(writer, e); t.DeserializeComponent(reader, e); }; }
+		static constexpr bool HasConcurrentDeserialization() { if constexpr (requires { T::ConcurrentDeserialization; }) return T::ConcurrentDeserialization; else return false; }
 
 		inline static void RegisterComponent()
 		{
@@ -118,6 +157,14 @@ public:
 			cc.DeserializeComponent = T::StaticDeserializeComponent;
 			cc.OnImGuiRender = T::StaticOnImGuiRender;
 			cc.OnImGuizmo = T::StaticOnImGuizmo;
+			cc.ReserveComponents = T::StaticReserveComponents;
+			cc.ConcurrentDeserialization = HasConcurrentDeserialization();
+			if constexpr (std::is_copy_constructible_v<T>) cc.CloneComponents = T::StaticCloneComponents;
+			if constexpr (HasBinarySerialization())
+			{
+				cc.SerializeBinary = T::StaticSerializeBinary;
+				cc.DeserializeBinary = T::StaticDeserializeBinary;
+			}
 			ComponentManager::AddComponent(cc);
 		}
 
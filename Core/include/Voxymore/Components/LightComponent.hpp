@@ -16,6 +16,7 @@ namespace Voxymore::Core
 	class LightComponent : public Component<LightComponent>
 	{
 		VXM_IMPLEMENT_COMPONENT(LightComponent);
+		static constexpr bool ConcurrentDeserialization = true;
 	public:
 		inline LightComponent() = default;
 		inline ~LightComponent() = default;
@@ -0,0 +1,132 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Macros.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Append-only little helper to write plain data in a byte buffer.
+	 * Values are written in the native layout without padding, they are meant to be read back by a BinaryReader on the same platform.
+	 */
+	class BinaryWriter
+	{
+	public:
+		BinaryWriter() = default;
+
+		template<typename T>
+		inline void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as raw bytes.");
+			WriteBytes(&value, sizeof(T));
+		}
+
+		template<typename T>
+		inline void WriteArray(std::span<const T> values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as raw bytes.");
+			WriteBytes(values.data(), values.size_bytes());
+		}
+
+		void WriteString(const std::string& value);
+		void WriteBytes(const void* data, size_t size);
+
+		/**
+		 * @brief Reserve room for a value that is only known later.
+		 * @return The offset to give to WriteAt once the value is known.
+		 */
+		template<typename T>
+		inline size_t Reserve()
+		{
+			size_t offset = m_Buffer.size();
+			m_Buffer.resize(offset + sizeof(T));
+			return offset;
+		}
+
+		template<typename T>
+		inline void WriteAt(size_t offset, const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as raw bytes.");
+			VXM_CORE_ASSERT(offset + sizeof(T) <= m_Buffer.size(), "Writing outside of the buffer.");
+			std::memcpy(m_Buffer.data() + offset, &value, sizeof(T));
+		}
+
+		[[nodiscard]] inline size_t size() const { return m_Buffer.size(); }
+		[[nodiscard]] inline const std::vector<uint8_t>& GetBuffer() const { return m_Buffer; }
+
+		bool WriteToFile(const std::filesystem::path& path) const;
+	private:
+		std::vector<uint8_t> m_Buffer;
+	};
+
+	/**
+	 * @brief Bound-checked cursor over a byte buffer, typically a MappedFile.
+	 * A read past the end marks the reader as failed and returns default values, check IsValid once the reading is done.
+	 */
+	class BinaryReader
+	{
+	public:
+		BinaryReader() = default;
+		inline BinaryReader(std::span<const uint8_t> data) : m_Data(data) {}
+		inline BinaryReader(const uint8_t* data, size_t size) : m_Data(data, size) {}
+
+		template<typename T>
+		inline T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read as raw bytes.");
+			T value{};
+			ReadBytes(&value, sizeof(T));
+			return value;
+		}
+
+		template<typename T>
+		inline void Read(T& value)
+		{
+			value = Read<T>();
+		}
+
+		/**
+		 * @brief Copy the next values in the array, the data might not be aligned so it's never accessed in place.
+		 */
+		template<typename T>
+		inline void ReadArray(std::span<T> values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read as raw bytes.");
+			ReadBytes(values.data(), values.size_bytes());
+		}
+
+		std::string ReadString();
+		void ReadBytes(void* data, size_t size);
+		void Skip(size_t size);
+
+		/**
+		 * @brief Create a reader over the next bytes and skip them.
+		 */
+		BinaryReader SubReader(size_t size);
+		/**
+		 * @brief Create a reader over the bytes [offset, offset + size[ of this reader, regardless of the cursor.
+		 */
+		BinaryReader SubReader(size_t offset, size_t size);
+
+		[[nodiscard]] inline bool IsValid() const { return !m_Failed; }
+		[[nodiscard]] inline size_t GetOffset() const { return m_Offset; }
+		[[nodiscard]] inline size_t Remaining() const { return m_Data.size() - m_Offset; }
+	private:
+		bool Request(size_t size);
+	private:
+		std::span<const uint8_t> m_Data;
+		size_t m_Offset = 0;
+		bool m_Failed = false;
+	};
+
+} // namespace Voxymore::Core
@@ -4,8 +4,11 @@
 #include "Voxymore/Core/YamlHelper.hpp"
 #include "Voxymore/Core/UUID.hpp"
 #include "Voxymore/Core/Logger.hpp"
+#include "Voxymore/Core/MappedFile.hpp"
 #include "Voxymore/Debug/Profiling.hpp"
+#include <cstring>
 #include <filesystem>
+#include <type_traits>
 
 namespace Voxymore::Core
 {
@@ -103,8 +106,15 @@ namespace Voxymore::Core
 		static std::string ReadFileAsString(const Path& path);
 		static YAML::Node ReadFileAsYAML(const Path& path);
 
+		/**
+		 * @brief Read the whole file as an array of T, a last partial element is padded with zeros.
+		 */
 		template<typename T>
 		static std::vector<T> ReadFile(const Path& path);
+		/**
+		 * @brief Map the file in memory to read it without any copy.
+		 */
+		static MappedFile MapFile(const Path& path);
 
 		static std::string ReadFileHash(const Path& path);
 		static void WriteYamlFile(const Path& path, YAML::Emitter& emitter);
@@ -132,17 +142,15 @@ namespace Voxymore::Core
 	inline std::vector<T> FileSystem::ReadFile(const Path &path)
 	{
 		VXM_PROFILE_FUNCTION();
+		static_assert(std::is_trivially_copyable_v<T>, "The file is copied as raw bytes in the elements.");
 		std::vector<T> result;
-		std::ifstream file(path.GetFullPath(), std::ios::binary);
-		char buffer [sizeof(T)];
+		MappedFile file(path.GetFullPath());
 		if(file) {
-			do {
-				std::memset(buffer, 0, sizeof(T));
-				file.read(buffer, sizeof(T));
-				if (file.tellg() > 0) {
-					result.push_back(*(T *) buffer);
-				}
-			} while (file.good());
+			// Sized once and copied in one go, the value-initialized elements pad the last partial one with zeros.
+			result.resize((file.size() + sizeof(T) - 1) / sizeof(T));
+			if(!file.empty()) {
+				std::memcpy(result.data(), file.data(), file.size());
+			}
 		} else {
 			VXM_CORE_ERROR("Could not open file '{0}'.", path.GetFullPath().string());
 		}
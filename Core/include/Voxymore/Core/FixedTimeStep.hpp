@@ -0,0 +1,87 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Core/TimeStep.hpp"
+#include <cstdint>
+
+#ifndef VXM_DEFAULT_FIXED_DELTA_TIME
+#define VXM_DEFAULT_FIXED_DELTA_TIME (1.0 / 60.0)
+#endif
+
+#ifndef VXM_DEFAULT_MAX_SUB_STEPS
+#define VXM_DEFAULT_MAX_SUB_STEPS 4
+#endif
+
+#ifndef VXM_DEFAULT_PHYSICS_INTERPOLATION
+#define VXM_DEFAULT_PHYSICS_INTERPOLATION true
+#endif
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Accumulate the frame time and turn it into a number of steps of a fixed duration.
+	 *
+	 * The number of steps per frame is capped so a slow frame doesn't make the simulation spiral.
+	 * The time that couldn't be simulated is dropped and the simulation runs slower than real time instead.
+	 * The time left in the accumulator gives the interpolation factor between the last two steps.
+	 */
+	class FixedTimeStep
+	{
+	public:
+		FixedTimeStep(TimeType fixedDeltaTime = VXM_DEFAULT_FIXED_DELTA_TIME, uint32_t maxSubSteps = VXM_DEFAULT_MAX_SUB_STEPS);
+		~FixedTimeStep() = default;
+	public:
+		/**
+		 * @brief Add the time of the frame to the accumulator.
+		 * @return The number of fixed steps to run this frame.
+		 */
+		uint32_t Advance(TimeStep frameTime);
+
+		/**
+		 * @brief Advance by the frame time and call the function once per fixed step.
+		 * @return The number of steps run.
+		 */
+		template<typename Func>
+		inline uint32_t Run(TimeStep frameTime, Func&& step)
+		{
+			const uint32_t count = Advance(frameTime);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				step(GetFixedDeltaTime(), i, count);
+			}
+			return count;
+		}
+
+		/**
+		 * @brief Remove all the time accumulated.
+		 */
+		void Reset();
+
+		/**
+		 * @return The ratio of a step left in the accumulator, in [0, 1), used to interpolate between the last two steps.
+		 */
+		[[nodiscard]] TimeType GetAlpha() const;
+
+		[[nodiscard]] inline TimeStep GetFixedDeltaTime() const { return TimeStep(m_FixedDeltaTime); }
+		void SetFixedDeltaTime(TimeType fixedDeltaTime);
+
+		[[nodiscard]] inline uint32_t GetMaxSubSteps() const { return m_MaxSubSteps; }
+		void SetMaxSubSteps(uint32_t maxSubSteps);
+
+		/**
+		 * @return The total time simulated since the last reset.
+		 */
+		[[nodiscard]] inline double GetSimulatedTime() const { return m_SimulatedTime; }
+	private:
+		TimeType m_FixedDeltaTime;
+		TimeType m_Accumulator = 0;
+		double m_SimulatedTime = 0;
+		uint32_t m_MaxSubSteps;
+	};
+
+} // namespace Voxymore::Core
+
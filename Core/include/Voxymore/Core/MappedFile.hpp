@@ -0,0 +1,66 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Read-only view of a whole file mapped in memory.
+	 *
+	 * The content is paged in by the OS on access instead of being copied through a stream buffer,
+	 * which makes it the cheapest way to read large binary caches.
+	 * The view is valid as long as the MappedFile is alive.
+	 */
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::filesystem::path& path);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/**
+		 * @brief Map the file, closing the previous one.
+		 * @return Whether the file could be opened. An empty file is opened but has no data.
+		 */
+		bool Open(const std::filesystem::path& path);
+		void Close();
+
+		[[nodiscard]] inline bool IsOpen() const { return m_IsOpen; }
+		[[nodiscard]] inline explicit operator bool() const { return m_IsOpen; }
+
+		[[nodiscard]] inline const uint8_t* data() const { return m_Data; }
+		[[nodiscard]] inline size_t size() const { return m_Size; }
+		[[nodiscard]] inline bool empty() const { return m_Size == 0; }
+
+		/**
+		 * @brief The content of the file as an array of T, a last partial element is left out.
+		 */
+		template<typename T>
+		[[nodiscard]] inline std::span<const T> As() const { return {reinterpret_cast<const T*>(m_Data), m_Size / sizeof(T)}; }
+	private:
+		void Swap(MappedFile& other) noexcept;
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+		bool m_IsOpen = false;
+#if defined(_WIN32)
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+#else
+		int m_File = -1;
+#endif
+	};
+
+} // namespace Voxymore::Core
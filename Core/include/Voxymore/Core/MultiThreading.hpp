@@ -7,8 +7,17 @@
 #include "Voxymore/Core/PlatformDetection.hpp"
 #include "Voxymore/Core/Logger.hpp"
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <thread>
+#include <vector>
 
 #if !(defined(__APPLE__) || defined(__MACH__))
 #include <execution>
@@ -77,4 +86,102 @@ namespace Voxymore::Core
 	{
 		return std::thread::hardware_concurrency();
 	}
+
+	class JobSystem;
+
+	/**
+	 * @brief Handle on a job scheduled in a JobSystem, used to wait for it or to make other jobs depend on it.
+	 * An empty handle is considered as finished.
+	 */
+	class JobHandle
+	{
+		friend class JobSystem;
+	private:
+		struct Job
+		{
+			std::function<void()> function;
+			// The unfinished dependencies, plus one held while the job is being scheduled.
+			std::atomic<uint32_t> pendingDependencies{1};
+			std::atomic<bool> finished{false};
+			std::mutex mutex;
+			// The jobs waiting for this one, guarded by the mutex.
+			std::vector<std::shared_ptr<Job>> continuations;
+		};
+	public:
+		JobHandle() = default;
+		~JobHandle() = default;
+
+		[[nodiscard]] inline bool IsValid() const { return m_Job != nullptr; }
+		[[nodiscard]] inline bool IsFinished() const { return !m_Job || m_Job->finished.load(std::memory_order_acquire); }
+	private:
+		explicit JobHandle(std::shared_ptr<Job> job) : m_Job(std::move(job)) {}
+	private:
+		std::shared_ptr<Job> m_Job = nullptr;
+	};
+
+	/**
+	 * @brief Pool of worker threads running jobs, with dependencies between the jobs.
+	 *
+	 * Each worker owns a deque: it pushes and pops its own jobs at the back (the most recent, still in cache)
+	 * and steals the oldest job at the front of another worker's deque when its own is empty.
+	 * A job only becomes runnable once all its dependencies are finished.
+	 * A thread waiting on a job runs the pending jobs in the meantime, so a job can wait for other jobs without dead-locking the pool.
+	 */
+	class JobSystem
+	{
+	private:
+		using Job = JobHandle::Job;
+		struct WorkerQueue
+		{
+			std::mutex mutex;
+			std::deque<std::shared_ptr<Job>> jobs;
+		};
+	public:
+		/**
+		 * @param workerCount The number of worker threads, 0 to use one thread per core minus the calling thread.
+		 */
+		explicit JobSystem(uint32_t workerCount = 0);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/**
+		 * @brief The job system shared by the engine, created on the first call.
+		 */
+		static JobSystem& Get();
+
+		/**
+		 * @brief Schedule a function to run on the workers once all the dependencies are finished.
+		 */
+		JobHandle Schedule(std::function<void()> function, std::span<const JobHandle> dependencies = {});
+		inline JobHandle Schedule(std::function<void()> function, std::initializer_list<JobHandle> dependencies) { return Schedule(std::move(function), std::span<const JobHandle>(dependencies.begin(), dependencies.size())); }
+
+		/**
+		 * @brief Block until the job is finished, running other jobs in the meantime.
+		 */
+		void WaitFor(const JobHandle& handle);
+		void WaitFor(std::span<const JobHandle> handles);
+
+		[[nodiscard]] inline uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+	private:
+		void WorkerLoop(uint32_t index);
+		void Push(std::shared_ptr<Job> job);
+		std::shared_ptr<Job> Pop();
+		std::shared_ptr<Job> Steal(uint32_t thief);
+		/**
+		 * @return Whether a job has been found and run.
+		 */
+		bool RunOne();
+		void Execute(const std::shared_ptr<Job>& job);
+		[[nodiscard]] uint32_t GetCurrentQueue() const;
+	private:
+		std::vector<std::thread> m_Workers;
+		std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+		mutable std::atomic<uint32_t> m_NextQueue{0};
+		std::atomic<uint32_t> m_QueuedJobs{0};
+		std::atomic<bool> m_Running{true};
+		std::mutex m_SleepMutex;
+		std::condition_variable m_SleepCondition;
+	};
 }
@@ -29,6 +29,17 @@ namespace Voxymore::Core
 		void Grow(const Vec3& point);
 
 		void Move(const Vec3& movement);
+		/**
+		 * @brief Grow the box by the margin on every side.
+		 */
+		void Inflate(Real margin);
+		/**
+		 * @brief Extend the box in the direction of the displacement (i.e. the volume swept by the box on the displacement).
+		 */
+		void Stretch(const Vec3& displacement);
+
+		[[nodiscard]] bool Contains(const BoundingBox& other) const;
+		[[nodiscard]] Real GetSurfaceArea() const;
 
 		[[nodiscard]] Vec3 GetCenter() const;
 		[[nodiscard]] Vec3 GetHalfSize() const;
@@ -48,11 +59,11 @@ namespace Voxymore::Core
 		[[nodiscard]] operator bool() const;
 	private:
 		Vec3 m_Min = Vec3(std::numeric_limits<Real>::max());
-		Vec3 m_Max = Vec3(std::numeric_limits<Real>::min());
+		Vec3 m_Max = Vec3(std::numeric_limits<Real>::lowest());
 	};
 
 	template<class ListVec3>
-	BoundingBox::BoundingBox(const ListVec3 &points) : m_Max(std::numeric_limits<Real>::min()), m_Min(std::numeric_limits<Real>::max())
+	BoundingBox::BoundingBox(const ListVec3 &points) : m_Max(std::numeric_limits<Real>::lowest()), m_Min(std::numeric_limits<Real>::max())
 	{
 		VXM_PROFILE_FUNCTION();
 		for(const Vec3& point : points)
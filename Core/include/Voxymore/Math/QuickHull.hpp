@@ -0,0 +1,56 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Math/Math.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * A closed convex polyhedron given by its vertices and its faces.
+	 */
+	struct ConvexPolyhedron
+	{
+		struct Face
+		{
+			/**
+			 * The normal of the face, pointing outside the polyhedron.
+			 */
+			Vec3 normal = Vec3(0);
+			/**
+			 * The distance of the plane of the face to the origin along its normal.
+			 */
+			Real offset = 0;
+			/**
+			 * The index of the vertices of the face, counter-clockwise seen from outside.
+			 */
+			std::vector<uint32_t> vertices;
+		};
+
+		std::vector<Vec3> vertices;
+		std::vector<Face> faces;
+	};
+
+	/**
+	 * @brief The convex hull of a point cloud, computed with the quickhull algorithm.
+	 *
+	 * The hull starts as the largest tetrahedron found among the extreme points,
+	 * then repeatedly adds the point the furthest outside of one of its faces,
+	 * replacing the faces that point can see by a fan of triangles joining it to their horizon.
+	 * The points inside the hull, or closer to it than a tolerance relative to the size of the cloud, are dropped.
+	 * The coplanar triangles are finally merged in polygonal faces.
+	 */
+	class QuickHull
+	{
+	public:
+		/**
+		 * @return Whether the hull could be built, false when the points are all on a plane.
+		 */
+		static bool Compute(const std::vector<Vec3>& points, ConvexPolyhedron& hull);
+	};
+
+} // namespace Voxymore::Core
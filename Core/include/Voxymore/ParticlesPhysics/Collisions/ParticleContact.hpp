@@ -51,6 +51,13 @@ namespace Voxymore::Core
 		 */
 		void Resolve(TimeStep duration);
 
+		/**
+		 * Resolve this contact for both velocity and interpenetration.
+		 * @param duration duration of the frame of the contact.
+		 * @param particleMovement The movement applied to each particle to resolve the interpenetration.
+		 */
+		void Resolve(TimeStep duration, std::array<Vec3, 2>& particleMovement);
+
 		/**
 		 * Calculates the separating velocity at this contact.
 		 * @return
@@ -78,6 +85,7 @@ namespace Voxymore::Core
 		 * Resolves the interpenetration between the particles involved in this contact.
 		 *
 		 * @param duration The duration of the frame of the contact.
+		 * @param particleMovement The movement applied to each particle.
 		 *
 		 * This function resolves the interpenetration between the particles involved in this contact.
 		 * Interpenetration occurs when two particles overlap in space due to a collision or external force.
@@ -89,7 +97,7 @@ namespace Voxymore::Core
 		 * @note This function should be called after the ResolveVelocity function to ensure that the velocity of the
 		 * particles has been properly updated before resolving the interpenetration.
 		 */
-		void ResolveInterpenetration(TimeStep duration);
+		void ResolveInterpenetration(TimeStep duration, std::array<Vec3, 2>& particleMovement);
 	};
 } // namespace Voxymore::Core
 
@@ -0,0 +1,27 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "ParticleContact.hpp"
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Find the contacts between the particles, or between the particles and the scenery.
+	 * The generators registered in the ParticlePhysicsLayer run after each fixed step, right before the contacts are resolved,
+	 * so the contacts always match the current positions of the particles.
+	 */
+	class ParticleContactGenerator
+	{
+	public:
+		virtual ~ParticleContactGenerator() = default;
+
+		/**
+		 * @brief Append the contacts found in the current state of the particles.
+		 */
+		virtual void AddContacts(std::vector<ParticleContact>& contacts) = 0;
+	};
+} // namespace Voxymore::Core
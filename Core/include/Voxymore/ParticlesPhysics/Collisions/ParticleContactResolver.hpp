@@ -7,12 +7,30 @@
 #include "ParticleContact.hpp"
 #include "Voxymore/Core/TimeStep.hpp"
 #include "Voxymore/Math/Math.hpp"
+#include <array>
+#include <utility>
+#include <vector>
 
 namespace Voxymore::Core
 {
 
+	/**
+	 * @brief Resolve the contacts from the most severe to the least severe.
+	 *
+	 * The contacts are kept in a binary heap sorted by separating velocity.
+	 * Resolving a contact only changes the particles it involves,
+	 * so only the contacts sharing one of those particles are updated in the heap,
+	 * which makes each iteration logarithmic instead of linear in the number of contacts.
+	 */
 	class ParticleContactResolver
 	{
+	private:
+		struct ParticleLink
+		{
+			Particle* particle;
+			uint32_t contact;
+			uint32_t slot;
+		};
 	protected:
 		uint32_t iterations;
 		uint32_t iterationsUsed;
@@ -22,8 +40,38 @@ namespace Voxymore::Core
 		inline ~ParticleContactResolver() = default;
 
 		void SetIterations(uint32_t iterations);
+		[[nodiscard]] inline uint32_t GetIterationsUsed() const { return iterationsUsed; }
 
 		void ResolveContacts(TimeStep ts, std::vector<ParticleContact>& contacts);
+	private:
+		/**
+		 * @brief Find, for each particle of each contact, the range of m_Links holding the contacts sharing that particle.
+		 */
+		void BuildLinks(const std::vector<ParticleContact>& contacts);
+		void BuildHeap(const std::vector<ParticleContact>& contacts);
+
+		/**
+		 * @brief Move the contact in the heap according to its new priority, inserting or removing it if needed.
+		 */
+		void UpdateContact(const std::vector<ParticleContact>& contacts, uint32_t contact);
+
+		void HeapPush(uint32_t contact);
+		void HeapRemove(uint32_t contact);
+		void SiftUp(uint32_t position);
+		void SiftDown(uint32_t position);
+		void HeapSwap(uint32_t a, uint32_t b);
+
+		/**
+		 * @return The priority of the contact, the lowest is resolved first, REAL_MAX if the contact doesn't need to be resolved.
+		 */
+		[[nodiscard]] static Real GetPriority(const ParticleContact& contact);
+	private:
+		std::vector<ParticleLink> m_Links;
+		std::vector<std::array<std::pair<uint32_t, uint32_t>, 2>> m_LinkRanges;
+
+		std::vector<uint32_t> m_Heap;
+		std::vector<uint32_t> m_HeapPositions;
+		std::vector<Real> m_Priorities;
 	};
 
 } // namespace Voxymore::Core
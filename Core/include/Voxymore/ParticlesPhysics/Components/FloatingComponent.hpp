@@ -29,6 +29,7 @@ namespace Voxymore::Core
 	class FloatingComponent : public Component<FloatingComponent>
 	{
 		VXM_IMPLEMENT_COMPONENT(FloatingComponent);
+		static constexpr bool ConcurrentDeserialization = true;
 	public:
 		FloatingComponent() = default;
 		~FloatingComponent() = default;
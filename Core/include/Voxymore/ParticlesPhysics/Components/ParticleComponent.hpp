@@ -16,12 +16,18 @@ namespace Voxymore::Core
 	{
 		friend class ParticlePhysicsLayer;
 		VXM_IMPLEMENT_COMPONENT(ParticleComponent);
+		static constexpr bool ConcurrentDeserialization = true;
 	public:
 		void DeserializeComponent(YAML::Node& node);
 		void SerializeComponent(YAML::Emitter& out);
 		bool OnImGuiRender();
 		ParticleComponent();
 		~ParticleComponent();
+		// The moves must stay declared so the registry relocating the component keeps its binding to the batch.
+		ParticleComponent(const ParticleComponent&) = default;
+		ParticleComponent(ParticleComponent&&) noexcept = default;
+		ParticleComponent& operator=(const ParticleComponent&) = default;
+		ParticleComponent& operator=(ParticleComponent&&) noexcept = default;
 		ParticleComponent(Vec3 acceleration, Vec3 velocity, Real damping, Real mass);
 	};
 } // namespace Voxymore::Core
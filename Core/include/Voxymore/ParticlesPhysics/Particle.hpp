@@ -10,20 +10,55 @@
 
 namespace Voxymore::Core
 {
+	class ParticleBatch;
+
+	/**
+	 * @brief A point mass.
+	 * Once bound to a ParticleBatch (i.e. while simulated by the ParticlePhysicsLayer), the state lives in the batch
+	 * and every accessor reads and writes it there, the members only holding the state while the particle is unbound.
+	 */
 	class Particle
 	{
+		friend class ParticleBatch;
 	public:
 		Particle(const Vec3& position, const Vec3& velocity = Vec3(0.0), const Vec3& acceleration = Vec3(0.0), Real damping = 0.999, Real inverseMass = 1.0);
 		Particle(const Vec3& position, const Vec3& ForceAccumulate, const Vec3& velocity = Vec3(0.0), const Vec3& acceleration = Vec3(0.0), Real damping = 0.999, Real inverseMass = 1.0);
 		inline Particle() = default;
 		inline ~Particle() = default;
 
-		[[nodiscard]] const Vec3& GetPosition() const;
-		[[nodiscard]] const Vec3& GetVelocity() const;
-		[[nodiscard]] const Vec3& GetAcceleration() const;
+		/**
+		 * @brief Copy the state of the particle, the copy is never bound to a batch.
+		 */
+		Particle(const Particle& other);
+		/**
+		 * @brief Move the particle, the binding to the batch follows it (i.e. when the registry relocates the component).
+		 */
+		Particle(Particle&& other) noexcept;
+		/**
+		 * @brief Copy the state of the other particle, keeping the binding of this one.
+		 */
+		Particle& operator=(const Particle& other);
+		/**
+		 * @brief Take the binding of the other particle if this one is unbound, otherwise only copy its state.
+		 */
+		Particle& operator=(Particle&& other) noexcept;
+
+		[[nodiscard]] Vec3 GetPosition() const;
+		[[nodiscard]] Vec3 GetVelocity() const;
+		[[nodiscard]] Vec3 GetAcceleration() const;
 		[[nodiscard]] Real GetDamping() const;
 		[[nodiscard]] Real GetMass() const;
 		[[nodiscard]] Real GetInverseMass() const;
+		[[nodiscard]] Vec3 GetForceAccumulate() const;
+
+		/**
+		 * @brief Whether the state of the particle lives in a ParticleBatch.
+		 */
+		[[nodiscard]] inline bool IsBound() const { return m_Batch != nullptr; }
+		/**
+		 * @brief The index of the particle in its batch, only valid while bound.
+		 */
+		[[nodiscard]] inline uint32_t GetBatchIndex() const { return m_BatchIndex; }
 
 		/**
 		 * @brief Set the position of the particle.
@@ -135,6 +170,8 @@ namespace Voxymore::Core
 		 * It clears all the accumulated forces acting on the particle.
 		 */
 		void ClearAccumulator();
+	private:
+		void CopyState(const Particle& other);
 	protected:
 		Vec3 m_Position = Vec3(0.0);
 		Vec3 m_Velocity = Vec3(0.0);
@@ -142,5 +179,8 @@ namespace Voxymore::Core
 		Real m_Damping = 0.9;
 		Real m_InverseMass = 1.0;
 		Vec3 m_ForceAccumulate = Vec3(0);
+	private:
+		ParticleBatch* m_Batch = nullptr;
+		uint32_t m_BatchIndex = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/ParticlesPhysics/Particle.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief The state of the simulated particles stored as structure of arrays to be integrated with SIMD instructions.
+	 *
+	 * The batch owns the state of the particles bound to it, the particles only reading and writing it through their index.
+	 * Each component of each vector is stored in its own contiguous array
+	 * so the integration loads, computes and stores 4 (SSE) or 8 (AVX) particles per instruction.
+	 * Removing a particle moves the last one in its place, so the batch stays packed.
+	 */
+	class ParticleBatch
+	{
+	private:
+		struct SoAVec3
+		{
+			std::vector<Real> x;
+			std::vector<Real> y;
+			std::vector<Real> z;
+
+			void push_back(const Vec3& value);
+			void reserve(size_t count);
+			void clear();
+			/**
+			 * @brief Move the last value at the index and remove the last one.
+			 */
+			void swap_remove(uint32_t index);
+			void fill(Real value);
+			[[nodiscard]] inline Vec3 Get(uint32_t index) const { return {x[index], y[index], z[index]}; }
+			inline void Set(uint32_t index, const Vec3& value) { x[index] = value.x; y[index] = value.y; z[index] = value.z; }
+		};
+	public:
+		ParticleBatch() = default;
+		~ParticleBatch() = default;
+		ParticleBatch(const ParticleBatch&) = delete;
+		ParticleBatch& operator=(const ParticleBatch&) = delete;
+	public:
+		/**
+		 * @brief Move the state of the particle in the batch and bind the particle to it.
+		 * @return The index of the particle in the batch.
+		 */
+		uint32_t Add(entt::entity entity, Particle& particle);
+
+		/**
+		 * @brief Copy the state of the particle back in it and unbind it.
+		 * The last particle of the batch takes its index and must be rebound with Rebind.
+		 * @return The entity of the particle that moved, entt::null if none did.
+		 */
+		entt::entity Remove(Particle& particle);
+
+		/**
+		 * @brief Update the index of a particle moved by a removal.
+		 */
+		void Rebind(entt::entity entity, Particle& particle) const;
+
+		/**
+		 * @brief Integrate all the particles of the batch over the timestep.
+		 * Same computation as Particle::Integrate, the particles without a valid inverse mass don't move.
+		 * The forces are kept, to be applied on each fixed step of the frame.
+		 */
+		void Integrate(Real ts);
+
+		/**
+		 * @brief Clear the forces accumulated on all the particles.
+		 */
+		void ClearForces();
+
+		void Reserve(size_t count);
+
+		[[nodiscard]] inline size_t size() const { return m_InverseMass.size(); }
+		[[nodiscard]] inline bool empty() const { return m_InverseMass.empty(); }
+
+		[[nodiscard]] bool Contains(entt::entity entity) const;
+		[[nodiscard]] inline entt::entity GetEntity(uint32_t index) const { return m_Entities[index]; }
+
+		[[nodiscard]] inline Vec3 GetPosition(uint32_t index) const { return m_Position.Get(index); }
+		inline void SetPosition(uint32_t index, const Vec3& position) { m_Position.Set(index, position); }
+		[[nodiscard]] inline Vec3 GetVelocity(uint32_t index) const { return m_Velocity.Get(index); }
+		inline void SetVelocity(uint32_t index, const Vec3& velocity) { m_Velocity.Set(index, velocity); }
+		[[nodiscard]] inline Vec3 GetAcceleration(uint32_t index) const { return m_Acceleration.Get(index); }
+		inline void SetAcceleration(uint32_t index, const Vec3& acceleration) { m_Acceleration.Set(index, acceleration); }
+		[[nodiscard]] inline Vec3 GetForce(uint32_t index) const { return m_Force.Get(index); }
+		inline void SetForce(uint32_t index, const Vec3& force) { m_Force.Set(index, force); }
+		inline void AddForce(uint32_t index, const Vec3& force) { m_Force.Set(index, m_Force.Get(index) + force); }
+		[[nodiscard]] inline Real GetDamping(uint32_t index) const { return m_Damping[index]; }
+		inline void SetDamping(uint32_t index, Real damping) { m_Damping[index] = damping; }
+		[[nodiscard]] inline Real GetInverseMass(uint32_t index) const { return m_InverseMass[index]; }
+		inline void SetInverseMass(uint32_t index, Real inverseMass) { m_InverseMass[index] = inverseMass; }
+	private:
+		static void IntegrateComponent(size_t count, Real* position, Real* velocity, const Real* acceleration, const Real* force, const Real* inverseMass, const Real* damping, const Real* timeStep);
+	private:
+		SoAVec3 m_Position;
+		SoAVec3 m_Velocity;
+		SoAVec3 m_Acceleration;
+		SoAVec3 m_Force;
+		std::vector<Real> m_Damping;
+		std::vector<Real> m_InverseMass;
+		// pow(damping, ts), computed at the start of the integration.
+		std::vector<Real> m_DampingFactor;
+		// The timestep of each particle, 0 for those without a valid inverse mass so they don't move.
+		std::vector<Real> m_TimeStep;
+
+		std::vector<entt::entity> m_Entities;
+		std::unordered_map<entt::entity, uint32_t> m_Indices;
+	};
+
+} // namespace Voxymore::Core
+
@@ -14,12 +14,32 @@
 #include "Voxymore/Events/ApplicationEvent.hpp"
 
 #include "Voxymore/Core/FileSystem.hpp"
+#include "Voxymore/Core/FixedTimeStep.hpp"
 #include "Voxymore/Scene/Scene.hpp"
+#include "Voxymore/Scene/TransformSnapshots.hpp"
 
 #include "Voxymore/ParticlesPhysics/Collisions/ParticleContact.hpp"
+#include "Voxymore/ParticlesPhysics/Collisions/ParticleContactGenerator.hpp"
 #include "Voxymore/ParticlesPhysics/Collisions/ParticleContactResolver.hpp"
+#include "Voxymore/ParticlesPhysics/ParticleBatch.hpp"
+
 namespace Voxymore::Core
 {
+	/**
+	 * @brief What the fixed steps cost since the last reset, summed over all the steps.
+	 */
+	struct ParticlePhysicsStats
+	{
+		// Time spent in each phase, in seconds.
+		double integrate = 0;
+		double resolve = 0;
+
+		uint64_t steps = 0;
+		uint64_t contacts = 0;
+	};
+
+	class ParticleComponent;
+	struct TransformComponent;
 
 	class ParticlePhysicsLayer : public Layer
 	{
@@ -37,15 +57,79 @@ namespace Voxymore::Core
 		const Vec3& GetGravity() const;
 		void SetGravity(const Vec3& g);
 
+		/**
+		 * @brief Add a contact found by the caller for this frame, resolved once after the first fixed step.
+		 * The contacts that must follow the particles from one step to the other come from a ParticleContactGenerator.
+		 */
 		void AddContact(const ParticleContact& contact);
 		void AddContacts(const std::vector<ParticleContact>& contacts);
+
+		/**
+		 * @brief Register a generator run after each fixed step to find the contacts of the particles.
+		 */
+		void AddContactGenerator(Ref<ParticleContactGenerator> generator);
+		void RemoveContactGenerator(const Ref<ParticleContactGenerator>& generator);
+
+		/**
+		 * @brief Run a number of fixed steps right away, independently of the frame time.
+		 * Used to simulate without rendering (i.e. headless batches).
+		 */
+		void Simulate(uint32_t stepCount);
+
+		inline FixedTimeStep& GetFixedTimeStep() { return m_FixedTimeStep; }
+		[[nodiscard]] inline const FixedTimeStep& GetFixedTimeStep() const { return m_FixedTimeStep; }
+
+		inline void SetInterpolation(bool interpolate) { m_Interpolate = interpolate; }
+		[[nodiscard]] inline bool IsInterpolating() const { return m_Interpolate; }
+
+		[[nodiscard]] inline const ParticlePhysicsStats& GetStats() const { return m_Stats; }
+		inline void ResetStats() { m_Stats = ParticlePhysicsStats(); }
 	private:
 		[[nodiscard]] bool HasScene() const;
+
+		void ConnectScene();
+		void DisconnectScene();
+
+		/**
+		 * @brief Move the state of the particle of the entity in the batch, unless the entity is disabled.
+		 */
+		void OnAddParticle(entt::entity e);
+		/**
+		 * @brief Move the state of the particle of the entity back in its component.
+		 */
+		void OnRemoveParticle(entt::entity e);
+		void OnEnableEntity(entt::entity e);
+
+		/**
+		 * @brief Find the TransformComponent of each particle of the batch and take its position,
+		 * so a transform moved outside of the physics teleports its particle.
+		 */
+		void GatherTransforms();
+		/**
+		 * @brief Copy the position of the particles in their TransformComponent if any.
+		 */
+		void SyncTransforms();
+
+		void SimulateSteps(uint32_t stepCount);
+		void RestoreTransforms();
+		void InterpolateTransforms(Real alpha);
 	private:
 		Vec3 m_Gravity = Vec3(0.0, -9.8, 0.0);
 		Ref<Scene> m_SceneHandle = nullptr;
+		// The contacts added by the caller for the current frame.
 		std::vector<ParticleContact> m_Contacts;
+		// The contacts resolved after the current fixed step.
+		std::vector<ParticleContact> m_StepContacts;
+		std::vector<Ref<ParticleContactGenerator>> m_ContactGenerators;
 		ParticleContactResolver m_Resolver;
+		// Owns the state of the enabled particles of the scene, the components reading it through their index.
+		ParticleBatch m_Batch;
+		// The TransformComponent of each index of the batch, nullptr if the particle doesn't have one.
+		std::vector<TransformComponent*> m_Transforms;
+		FixedTimeStep m_FixedTimeStep;
+		TransformSnapshots m_Snapshots;
+		bool m_Interpolate = VXM_DEFAULT_PHYSICS_INTERPOLATION;
+		ParticlePhysicsStats m_Stats;
 	};
 
 } // namespace Voxymore::Core
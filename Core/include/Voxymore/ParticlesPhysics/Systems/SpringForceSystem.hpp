@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Voxymore/ParticlesPhysics/Components/AnchoredSpringComponent.hpp"
+#include "Voxymore/Scene/ForceAccumulator.hpp"
 #include "Voxymore/Scene/Systems.hpp"
 
 namespace Voxymore::Core
@@ -18,6 +19,8 @@ namespace Voxymore::Core
 	public:
 		void Update(Scene& scene, TimeStep ts) override;
 		inline bool RunOnAllScenes() override {return true;}
+	private:
+		ForceAccumulator m_Forces;
 	};
 
 } // namespace Voxymore::Core
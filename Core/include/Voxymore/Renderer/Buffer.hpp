@@ -75,6 +75,11 @@ namespace Voxymore::Core {
         virtual void SetLayout(const BufferLayout& layout) = 0;
         virtual const BufferLayout& GetLayout() const = 0;
 
+        /**
+         * @brief Read back the first `size` bytes of the buffer from the GPU, must be called on the renderer thread.
+         */
+        virtual void GetData(void* data, uint32_t size) const = 0;
+
         static Ref<VertexBuffer> Create(uint32_t size, const void* vertices);
     };
 
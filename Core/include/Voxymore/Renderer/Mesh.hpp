@@ -75,6 +75,11 @@ namespace Voxymore::Core
 		[[nodiscard]] inline UUID id() const { return Handle; }
 
 		inline const BoundingBox& GetBoundingBox() const { return m_BoundingBox; }
+		/**
+		 * @brief The position of the vertices, read back from the vertex buffer on the first call to build the colliders from the mesh.
+		 * @note Must be called on the renderer thread.
+		 */
+		const std::vector<glm::vec3>& GetPositions() const;
 
 		inline void SetDrawMode(DrawMode drawMode) { m_DrawMode = drawMode; }
 		inline DrawMode GetDrawMode() const { return m_DrawMode; }
@@ -85,6 +90,8 @@ namespace Voxymore::Core
 		MaterialField m_Material;
 		BufferLayout m_BufferLayout;
 		BoundingBox m_BoundingBox;
+		mutable std::vector<glm::vec3> m_Positions;
+		uint32_t m_VertexCount = 0;
 		DrawMode m_DrawMode = DrawMode::Triangles;
 	};
 
@@ -18,6 +18,8 @@
 #include "Voxymore/Renderer/Model.hpp"
 #include "Voxymore/Renderer/Light.hpp"
 #include <map>
+#include <span>
+#include <unordered_map>
 
 namespace Voxymore::Core {
 
@@ -78,6 +80,18 @@ namespace Voxymore::Core {
 			int SampleAsRevolution = 0;
 		};
 
+		/**
+		 * The patch drawn for the curves, its vertices only hold the knots (or the indices of the control points) three by three.
+		 * The control points and weights go through the CurveParameters uniform block, so the same patch serves every curve with the same knots.
+		 */
+		struct CurveMesh
+		{
+			// Compared on each hit to tell apart two lists of knots with the same hash.
+			std::vector<float> Knots;
+			Ref<Mesh> Patch;
+			uint64_t LastUsedFrame = 0;
+		};
+
 		struct TesselationControlParams
 		{
 			float OuterLeft = 16.0f;
@@ -101,12 +115,18 @@ namespace Voxymore::Core {
 		Ref<UniformBuffer> TessCoParametersBuffer;
 		std::multimap<Real, std::tuple<const Ref<Mesh>, glm::mat4, int>> AlphaMeshes;
 		std::vector<std::tuple<const Ref<Mesh>, glm::mat4, int>> OpaqueMeshes;
+		std::unordered_map<uint64_t, CurveMesh> CurveMeshes;
+		Ref<Mesh> SurfacePatch;
+		uint64_t FrameIndex = 0;
 	};
 
 	class Renderer {
 	private:
 		static void Submit(const Ref<Model>& model, const Node& node, const glm::mat4& transform = glm::mat4(1.0f), int entityId = -1);
 		static void DrawMesh(Ref<Mesh> mesh, const glm::mat4& modelMatrix, int entityId = -1);
+		static const Ref<Mesh>& GetCurvePatch(std::span<const float> knots);
+		static void DrawCurvePatch(const Ref<Material>& material, const Ref<Mesh>& patch, uint32_t vertexCount, int entityId);
+		static void ReleaseUnusedCurvePatches();
 	public:
 		static void Init();
 		static void Shutdown();
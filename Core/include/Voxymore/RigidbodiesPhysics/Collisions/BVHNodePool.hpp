@@ -0,0 +1,102 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	inline constexpr uint32_t NullNode = std::numeric_limits<uint32_t>::max();
+
+	/**
+	 * @brief Contiguous storage for the nodes of a tree, addressed by 32 bits indices.
+	 *
+	 * The freed nodes are kept in a free list and reused by the next allocation.
+	 * The 'parent' member of a freed node is used as the link to the next free node,
+	 * so the Node type must have a 'uint32_t parent' member.
+	 * The memory is never released, so clearing the pool is O(1).
+	 */
+	template<class Node>
+	class BVHNodePool
+	{
+	public:
+		BVHNodePool() = default;
+		~BVHNodePool() = default;
+	public:
+		/**
+		 * @brief Get a default constructed node.
+		 * @return The index of the node.
+		 */
+		uint32_t Allocate();
+		void Free(uint32_t index);
+		/**
+		 * @brief Free all the nodes at once, keeping the memory for the next allocations.
+		 */
+		void Clear();
+		void Reserve(uint32_t count);
+
+		/**
+		 * @brief The number of slots in use or in the free list. Any valid index is lower than this number.
+		 */
+		[[nodiscard]] inline uint32_t GetSize() const { return m_Size; }
+		[[nodiscard]] inline bool IsValid(uint32_t index) const { return index < m_Size; }
+
+		inline Node& operator[](uint32_t index) { VXM_CORE_ASSERT(IsValid(index), "The node {0} is out of the pool.", index); return m_Nodes[index]; }
+		inline const Node& operator[](uint32_t index) const { VXM_CORE_ASSERT(IsValid(index), "The node {0} is out of the pool.", index); return m_Nodes[index]; }
+	private:
+		std::vector<Node> m_Nodes;
+		uint32_t m_Size = 0;
+		uint32_t m_FreeList = NullNode;
+	};
+
+	template<class Node>
+	uint32_t BVHNodePool<Node>::Allocate()
+	{
+		VXM_PROFILE_FUNCTION();
+		uint32_t index;
+		if(m_FreeList != NullNode)
+		{
+			index = m_FreeList;
+			m_FreeList = m_Nodes[index].parent;
+		}
+		else
+		{
+			index = m_Size++;
+			if(index == m_Nodes.size()) m_Nodes.emplace_back();
+		}
+
+		m_Nodes[index] = Node();
+		return index;
+	}
+
+	template<class Node>
+	void BVHNodePool<Node>::Free(uint32_t index)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(IsValid(index), "The node {0} is out of the pool.", index);
+		m_Nodes[index] = Node();
+		m_Nodes[index].parent = m_FreeList;
+		m_FreeList = index;
+	}
+
+	template<class Node>
+	void BVHNodePool<Node>::Clear()
+	{
+		m_Size = 0;
+		m_FreeList = NullNode;
+	}
+
+	template<class Node>
+	void BVHNodePool<Node>::Reserve(uint32_t count)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Nodes.reserve(count);
+	}
+
+} // namespace Voxymore::Core
+
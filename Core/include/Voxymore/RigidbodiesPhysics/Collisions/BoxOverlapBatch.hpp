@@ -0,0 +1,80 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	enum class SimdLevel : int
+	{
+		Scalar,
+		SSE4,
+		AVX2,
+	};
+
+	/**
+	 * @brief Box pairs stored as structure of arrays to be tested for overlap several pairs at a time.
+	 *
+	 * The pairs are added with Add and tested all at once with Test,
+	 * using 4 to 8 pairs per instruction depending on the instruction set supported by the CPU, checked at runtime.
+	 * The test is the separating axis test of IntersectionDetector::BoxAndBox on the 15 axes,
+	 * done in the space of the first box with the axes normalized and the scale moved to the half sizes.
+	 */
+	class BoxOverlapBatch
+	{
+	public:
+		// The arrays of a box: the center, the 3 normalized axes and the 3 half sizes along them.
+		static constexpr uint32_t CenterIndex = 0;
+		static constexpr uint32_t AxisIndex = 3;
+		static constexpr uint32_t ExtentIndex = 12;
+		static constexpr uint32_t ComponentCount = 15;
+	public:
+		BoxOverlapBatch();
+		~BoxOverlapBatch() = default;
+	public:
+		/**
+		 * @return The index of the pair in the batch.
+		 */
+		uint32_t Add(const Box& one, const Box& two);
+
+		/**
+		 * @brief Test all the pairs of the batch.
+		 * @return For each pair, whether the boxes overlap.
+		 */
+		const std::vector<uint8_t>& Test();
+
+		void Reserve(size_t count);
+		void Clear();
+
+		[[nodiscard]] inline size_t size() const { return m_Results.size(); }
+		[[nodiscard]] inline bool empty() const { return m_Results.empty(); }
+
+		/**
+		 * @brief Force an instruction set, clamped to the ones supported by the CPU.
+		 */
+		void SetSimdLevel(SimdLevel level);
+		[[nodiscard]] inline SimdLevel GetSimdLevel() const { return m_SimdLevel; }
+
+		/**
+		 * @return The best instruction set supported by the CPU and the build.
+		 */
+		static SimdLevel GetSupportedSimdLevel();
+	private:
+		static void AddBox(std::array<std::vector<Real>, ComponentCount>& arrays, const Box& box);
+	private:
+		std::array<std::vector<Real>, ComponentCount> m_One;
+		std::array<std::vector<Real>, ComponentCount> m_Two;
+		std::vector<uint8_t> m_Results;
+		SimdLevel m_SimdLevel;
+	};
+
+} // namespace Voxymore::Core
+
@@ -0,0 +1,92 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Core/SmartPointers.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/Math/BoundingBox.hpp"
+#include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadCollisions.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	enum class BroadPhaseType : int
+	{
+		DynamicBVH,
+		SweepAndPrune,
+	};
+
+	/**
+	 * @brief Interface of the broadphases used by the RigidbodyPhysicsLayer.
+	 *
+	 * A broadphase keeps one proxy per collider, each with a "fat" box (the box of the collider enlarged by a margin and the predicted displacement).
+	 * The potential contacts are the pairs of proxies whose fat boxes overlap, sorted by proxy id,
+	 * so every implementation gives the same vector for the same sequence of calls.
+	 * The static proxies (bodies that cannot move) are only paired with the dynamic ones.
+	 */
+	class BroadPhase
+	{
+	public:
+		BroadPhase(Real margin = 0.1, Real displacementMultiplier = 2);
+		virtual ~BroadPhase() = default;
+
+		static Scope<BroadPhase> Create(BroadPhaseType type);
+	public:
+		/**
+		 * @brief Create a proxy for the body.
+		 * @param filter The proxy is only paired with the proxies whose filter accepts it.
+		 * @param isStatic Whether the body cannot move, two static proxies are never paired.
+		 * @return The id of the proxy.
+		 */
+		virtual uint32_t CreateProxy(const BoundingBox& box, Rigidbody* body, Entity entity, const CollisionFilter& filter, bool isStatic) = 0;
+		virtual void DestroyProxy(uint32_t proxy) = 0;
+		/**
+		 * @brief Update the box of the proxy, nothing is done if the box is still inside the fat box of the proxy.
+		 * @param displacement The predicted displacement of the body, used to enlarge the fat box in the direction of the movement.
+		 * @return Whether the fat box of the proxy changed.
+		 */
+		virtual bool MoveProxy(uint32_t proxy, const BoundingBox& box, const Vec3& displacement) = 0;
+		virtual void SetProxyBody(uint32_t proxy, Rigidbody* body) = 0;
+		/**
+		 * @brief Change the filter of the proxy, its pairs are computed again if it changed.
+		 */
+		virtual void SetProxyFilter(uint32_t proxy, const CollisionFilter& filter) = 0;
+		virtual void SetProxyStatic(uint32_t proxy, bool isStatic) = 0;
+
+		[[nodiscard]] virtual const BoundingBox& GetFatBoundingBox(uint32_t proxy) const = 0;
+		[[nodiscard]] virtual uint32_t GetProxyCount() const = 0;
+
+		/**
+		 * @brief Append the pairs of proxies whose fat boxes overlap and whose filters accept each other to the contacts.
+		 * @return The number of potential contacts added.
+		 */
+		virtual uint32_t GetPotentialContacts(std::vector<PotentialContact>& contacts) = 0;
+		/**
+		 * @brief Append the bodies of the proxies whose fat boxes overlap the box, whatever their filter.
+		 * @return The number of bodies added.
+		 */
+		virtual uint32_t QueryProxies(const BoundingBox& box, std::vector<std::pair<Rigidbody*, Entity>>& bodies) = 0;
+
+		virtual void Clear() = 0;
+
+		[[nodiscard]] virtual BroadPhaseType GetType() const = 0;
+
+		inline void SetMargin(Real margin) { m_Margin = margin; }
+		[[nodiscard]] inline Real GetMargin() const { return m_Margin; }
+	protected:
+		[[nodiscard]] BoundingBox ComputeFatBoundingBox(const BoundingBox& box, const Vec3& displacement) const;
+		[[nodiscard]] static uint64_t MakePair(uint32_t a, uint32_t b);
+		[[nodiscard]] inline static uint32_t GetFirst(uint64_t pair) { return static_cast<uint32_t>(pair >> 32); }
+		[[nodiscard]] inline static uint32_t GetSecond(uint64_t pair) { return static_cast<uint32_t>(pair); }
+	protected:
+		Real m_Margin;
+		Real m_DisplacementMultiplier;
+	};
+
+} // namespace Voxymore::Core
+
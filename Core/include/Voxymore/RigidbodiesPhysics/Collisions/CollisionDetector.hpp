@@ -5,9 +5,13 @@
 #pragma once
 
 #include "Voxymore/Math/Math.hpp"
+#include "Voxymore/Math/BoundingBox.hpp"
 #include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
 #include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
 #include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContact.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/GJK.hpp"
+#include <array>
+#include <vector>
 
 namespace Voxymore::Core
 {
@@ -15,6 +19,10 @@ namespace Voxymore::Core
 	{
 	public:
 		static bool BoxAndHalfSpace(const Box& box, const Plane &plane);
+		/**
+		 * @brief Whether part of the axis aligned box is behind the plane, used to pair the bodies with the planes without any tree.
+		 */
+		static bool BoundingBoxAndHalfSpace(const BoundingBox& box, const Plane &plane);
 		/**
 		 * Calculates the penetration between two boxes along a given axis.
 		 *
@@ -33,8 +41,49 @@ namespace Voxymore::Core
 		static Real PenetrationOnAxis(const Box& one, const Box& two, const Vec3& axis, const Vec3& toCenter);
 		static bool BoxAndBox(const Box& one, const Box& two);
 		static Real TransformToAxis(const Box& box, const Vec3& axis);
+		/**
+		 * @brief GJK test between two bounded colliders (i.e. anything but a plane).
+		 */
+		static bool ConvexAndConvex(const PrimitiveCollider& one, const PrimitiveCollider& two);
+	};
+
+
+	/**
+	 * A contact of a BoxManifold, in the space of the first box.
+	 */
+	struct BoxManifoldPoint
+	{
+		Vec3 localPoint = Vec3(0);
+		Vec3 localNormal = Vec3(0);
+		Real penetration = 0;
+		uint32_t feature = 0;
 	};
 
+	/**
+	 * @brief The contacts of a pair of boxes, kept from one step to the other.
+	 *
+	 * While the boxes don't move relative to each other (i.e. resting in a stack),
+	 * the contacts are the same in the space of the first box and are reused without running the SAT test.
+	 * When the boxes are apart, the axis that separated them is tested first on the next step.
+	 */
+	struct BoxManifold
+	{
+		static constexpr uint32_t MaxPoints = 4;
+
+		std::array<BoxManifoldPoint, MaxPoints> points;
+		uint32_t pointCount = 0;
+		// Whether the second box is the first body of the contacts.
+		bool swapped = false;
+		// The SAT axis that separated the boxes on the last test, -1 if they were overlapping.
+		int32_t separatingAxis = -1;
+		// The transform of the second box in the space of the first one when the contacts were computed.
+		Mat4 relativeTransform = Mat4(0);
+		// The last step the pair was tested, used to forget the pairs that are not potential contacts anymore.
+		uint64_t lastStep = 0;
+
+		void Store(const Box& one, const std::vector<RigidbodyContact>& contacts, const Mat4& relative, bool swap);
+		uint32_t Emit(const Box& one, const Box& two, CollisionData* data) const;
+	};
 
 	class CollisionDetector
 	{
@@ -45,6 +94,17 @@ namespace Voxymore::Core
 		static uint32_t BoxAndHalfSpace(const Box& box, const Plane &plane, CollisionData *data);
 		static uint32_t BoxAndSphere(const Box& box, const Sphere& sphere, CollisionData* data);
 		static uint32_t BoxAndBox(const Box &one, const Box &two, CollisionData *data);
+		/**
+		 * @brief Box and box test generating up to 4 contacts, reusing and updating the manifold of the pair.
+		 */
+		static uint32_t BoxAndBox(const Box &one, const Box &two, CollisionData *data, BoxManifold& manifold);
+		/**
+		 * @brief GJK and EPA test between two bounded colliders.
+		 * The faces facing each other along the EPA normal are clipped to generate up to 4 contacts, a single contact at the deepest point is used otherwise (i.e. the spheres and the edge contacts).
+		 */
+		static uint32_t ConvexAndConvex(const PrimitiveCollider& one, const PrimitiveCollider& two, CollisionData* data);
+		static uint32_t ConvexHullAndHalfSpace(const ConvexHull& hull, const Plane& plane, CollisionData* data);
+		static uint32_t ConvexHullAndSphere(const ConvexHull& hull, const Sphere& sphere, CollisionData* data);
 
 		inline static uint32_t Collide(const Sphere& one, const Sphere& two, CollisionData* data) {return SphereAndSphere(one, two, data);}
 		inline static uint32_t Collide(const Sphere &one, const Plane &two, CollisionData *data) {return SphereAndHalfSpace(one, two, data);}
@@ -54,6 +114,70 @@ namespace Voxymore::Core
 		inline static uint32_t Collide(const Box& one, const Sphere& two, CollisionData* data) {return BoxAndSphere(one, two, data);}
 		inline static uint32_t Collide(const Sphere& two, const Box& one, CollisionData* data) {return BoxAndSphere(one, two, data);}
 		inline static uint32_t Collide(const Box &one, const Box &two, CollisionData *data) {return BoxAndBox(one, two, data);}
+		inline static uint32_t Collide(const Box &one, const Box &two, CollisionData *data, BoxManifold& manifold) {return BoxAndBox(one, two, data, manifold);}
+		inline static uint32_t Collide(const ConvexHull& one, const Plane& two, CollisionData* data) {return ConvexHullAndHalfSpace(one, two, data);}
+		inline static uint32_t Collide(const Plane& two, const ConvexHull& one, CollisionData* data) {return ConvexHullAndHalfSpace(one, two, data);}
+		inline static uint32_t Collide(const ConvexHull& one, const Sphere& two, CollisionData* data) {return ConvexHullAndSphere(one, two, data);}
+		inline static uint32_t Collide(const Sphere& two, const ConvexHull& one, CollisionData* data) {return ConvexHullAndSphere(one, two, data);}
+		inline static uint32_t Collide(const ConvexHull& one, const Box& two, CollisionData* data) {return ConvexAndConvex(one, two, data);}
+		inline static uint32_t Collide(const Box& one, const ConvexHull& two, CollisionData* data) {return ConvexAndConvex(one, two, data);}
+		inline static uint32_t Collide(const ConvexHull& one, const ConvexHull& two, CollisionData* data) {return ConvexAndConvex(one, two, data);}
+	};
+
+	/**
+	 * The first contact of a moving shape with another one.
+	 */
+	struct TimeOfImpact
+	{
+		/**
+		 * The fraction of the displacement done at the impact, between 0 and 1.
+		 */
+		Real time = 1;
+		Vec3 point = Vec3(0);
+		/**
+		 * The normal of the contact in world space, pointing toward the moving shape.
+		 */
+		Vec3 normal = Vec3(0);
+	};
+
+	/**
+	 * @brief Time of impact queries of a sphere sweeping along a displacement against a static collider.
+	 *
+	 * The shapes already overlapping at the start are not reported, the discrete tests take care of them.
+	 * Each query only reports an impact happening before toi.time, so the same TimeOfImpact can be passed to all the colliders to keep the first one.
+	 */
+	class ContinuousCollisionDetector
+	{
+	public:
+		static bool SweptSphereAndSphere(const Vec3& center, Real radius, const Vec3& displacement, const Sphere& sphere, TimeOfImpact& toi);
+		static bool SweptSphereAndHalfSpace(const Vec3& center, Real radius, const Vec3& displacement, const Plane& plane, TimeOfImpact& toi);
+		/**
+		 * @brief Conservative advancement: the sphere is moved by the distance to the box, which it cannot cross in less time, until they touch.
+		 */
+		static bool SweptSphereAndBox(const Vec3& center, Real radius, const Vec3& displacement, const Box& box, TimeOfImpact& toi);
+		/**
+		 * @brief Conservative advancement using the GJK distance from the center of the sphere to the hull.
+		 */
+		static bool SweptSphereAndConvexHull(const Vec3& center, Real radius, const Vec3& displacement, const ConvexHull& hull, TimeOfImpact& toi);
+
+		inline static bool Sweep(const Vec3& center, Real radius, const Vec3& displacement, const Sphere& sphere, TimeOfImpact& toi) {return SweptSphereAndSphere(center, radius, displacement, sphere, toi);}
+		inline static bool Sweep(const Vec3& center, Real radius, const Vec3& displacement, const Plane& plane, TimeOfImpact& toi) {return SweptSphereAndHalfSpace(center, radius, displacement, plane, toi);}
+		inline static bool Sweep(const Vec3& center, Real radius, const Vec3& displacement, const Box& box, TimeOfImpact& toi) {return SweptSphereAndBox(center, radius, displacement, box, toi);}
+		inline static bool Sweep(const Vec3& center, Real radius, const Vec3& displacement, const ConvexHull& hull, TimeOfImpact& toi) {return SweptSphereAndConvexHull(center, radius, displacement, hull, toi);}
+
+		/**
+		 * @return The radius of the biggest sphere centered on the collider and inside it, used as the swept shape of the collider.
+		 */
+		static Real GetInnerRadius(const Sphere& sphere);
+		static Real GetInnerRadius(const Box& box);
+		static Real GetInnerRadius(const Plane& plane);
+		static Real GetInnerRadius(const ConvexHull& hull);
+
+		/**
+		 * @return The center of the sphere of GetInnerRadius in world space, the position of the collider except for the hulls whose pivot can be anywhere.
+		 */
+		static Vec3 GetInnerCenter(const PrimitiveCollider& collider);
+		static Vec3 GetInnerCenter(const ConvexHull& hull);
 	};
 
 } // namespace Voxymore::Core
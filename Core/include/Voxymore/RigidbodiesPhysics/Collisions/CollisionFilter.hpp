@@ -0,0 +1,39 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#ifndef VXM_DEFAULT_COLLISION_CATEGORY
+#define VXM_DEFAULT_COLLISION_CATEGORY 0x00000001u
+#endif
+
+#ifndef VXM_DEFAULT_COLLISION_MASK
+#define VXM_DEFAULT_COLLISION_MASK 0xFFFFFFFFu
+#endif
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Which colliders can touch each other.
+	 *
+	 * Two colliders are paired by the broadphase only if the category of each one is in the mask of the other.
+	 * A trigger is paired like any other collider but never creates contacts, its overlaps are only reported.
+	 */
+	struct CollisionFilter
+	{
+		uint32_t category = VXM_DEFAULT_COLLISION_CATEGORY;
+		uint32_t mask = VXM_DEFAULT_COLLISION_MASK;
+		bool isTrigger = false;
+
+		[[nodiscard]] inline bool ShouldCollide(const CollisionFilter& other) const
+		{
+			return (category & other.mask) != 0 && (other.category & mask) != 0;
+		}
+
+		[[nodiscard]] inline bool operator==(const CollisionFilter& other) const = default;
+	};
+
+} // namespace Voxymore::Core
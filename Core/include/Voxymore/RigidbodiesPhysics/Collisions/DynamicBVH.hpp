@@ -0,0 +1,142 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/Math/BoundingBox.hpp"
+#include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadCollisions.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadPhase.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BVHNodePool.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Persistent bounding volume hierarchy of axis aligned boxes used as a broadphase.
+	 *
+	 * Each proxy (a leaf of the tree) stores a "fat" box, bigger than the real box of the collider,
+	 * so that a body moving a little doesn't need any update of the tree.
+	 * When a body leaves its fat box, the leaf is removed and reinserted and the tree is rebalanced using rotations.
+	 * The overlapping pairs are kept from one frame to the other and only the moved proxies are queried again.
+	 *
+	 * The static proxies are kept in a second tree so the big level geometry doesn't inflate the nodes of the moving bodies.
+	 * The static proxies are never paired together, the static tree is only queried by the dynamic proxies.
+	 */
+	class DynamicBVH : public BroadPhase
+	{
+	private:
+		struct Node
+		{
+			BoundingBox box;
+			Rigidbody* body = nullptr;
+			Entity entity = Entity();
+			CollisionFilter filter;
+			// Used as the 'next' node when the node is in the free list.
+			uint32_t parent = NullNode;
+			std::array<uint32_t, 2> children = {NullNode, NullNode};
+			// -1 when the node is free, 0 for a leaf.
+			int32_t height = -1;
+			bool moved = false;
+			// In which tree is the node.
+			bool isStatic = false;
+
+			[[nodiscard]] inline bool IsLeaf() const { return children[0] == NullNode; }
+		};
+	public:
+		DynamicBVH(Real margin = 0.1, Real displacementMultiplier = 2);
+		~DynamicBVH() override = default;
+	public:
+		uint32_t CreateProxy(const BoundingBox& box, Rigidbody* body, Entity entity, const CollisionFilter& filter, bool isStatic) override;
+		void DestroyProxy(uint32_t proxy) override;
+		/**
+		 * @brief Update the box of the proxy, the tree is only modified if the box leave the fat box of the proxy.
+		 * @param displacement The predicted displacement of the body, used to enlarge the fat box in the direction of the movement.
+		 * @return Whether the proxy was reinserted.
+		 */
+		bool MoveProxy(uint32_t proxy, const BoundingBox& box, const Vec3& displacement) override;
+		void SetProxyBody(uint32_t proxy, Rigidbody* body) override;
+		void SetProxyFilter(uint32_t proxy, const CollisionFilter& filter) override;
+		/**
+		 * @brief Move the proxy to the other tree if it changed.
+		 */
+		void SetProxyStatic(uint32_t proxy, bool isStatic) override;
+
+		[[nodiscard]] const BoundingBox& GetFatBoundingBox(uint32_t proxy) const override;
+		[[nodiscard]] inline uint32_t GetProxyCount() const override { return m_ProxyCount; }
+		/**
+		 * @return The height of the highest of the two trees.
+		 */
+		[[nodiscard]] int32_t GetHeight() const;
+
+		/**
+		 * @brief Update the persistent pairs using the moved proxies and append them to the contacts.
+		 * @return The number of potential contacts added.
+		 */
+		uint32_t GetPotentialContacts(std::vector<PotentialContact>& contacts) override;
+		uint32_t QueryProxies(const BoundingBox& box, std::vector<std::pair<Rigidbody*, Entity>>& bodies) override;
+
+		void Clear() override;
+
+		[[nodiscard]] inline BroadPhaseType GetType() const override { return BroadPhaseType::DynamicBVH; }
+	private:
+		template<typename Func>
+		void Query(uint32_t root, const BoundingBox& box, Func&& func);
+
+		[[nodiscard]] inline uint32_t& GetRoot(bool isStatic) { return isStatic ? m_StaticRoot : m_Root; }
+
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+		/**
+		 * @brief Rotate the subtree if it's imbalanced.
+		 * @return The new root of the subtree.
+		 */
+		uint32_t Balance(uint32_t index);
+		void Refit(uint32_t index);
+
+		void UpdatePairs();
+	private:
+		BVHNodePool<Node> m_Nodes;
+		std::vector<uint64_t> m_Pairs;
+		std::vector<uint64_t> m_NewPairs;
+		std::vector<uint32_t> m_MoveBuffer;
+		std::vector<uint32_t> m_Stack;
+		uint32_t m_Root = NullNode;
+		uint32_t m_StaticRoot = NullNode;
+		uint32_t m_ProxyCount = 0;
+	};
+
+	template<typename Func>
+	void DynamicBVH::Query(uint32_t root, const BoundingBox& box, Func&& func)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(root == NullNode) return;
+
+		m_Stack.clear();
+		m_Stack.push_back(root);
+		while(!m_Stack.empty())
+		{
+			uint32_t index = m_Stack.back();
+			m_Stack.pop_back();
+
+			const Node& node = m_Nodes[index];
+			if(!node.box.Overlaps(box)) continue;
+
+			if(node.IsLeaf())
+			{
+				func(index);
+			}
+			else
+			{
+				m_Stack.push_back(node.children[0]);
+				m_Stack.push_back(node.children[1]);
+			}
+		}
+	}
+
+} // namespace Voxymore::Core
+
@@ -0,0 +1,65 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
+
+namespace Voxymore::Core
+{
+	/**
+	 * The closest points of two convex shapes.
+	 */
+	struct ConvexDistance
+	{
+		bool overlap = false;
+		/**
+		 * The distance between the shapes, 0 if they overlap.
+		 */
+		Real distance = 0;
+		Vec3 pointOne = Vec3(0);
+		Vec3 pointTwo = Vec3(0);
+	};
+
+	/**
+	 * The smallest translation separating two overlapping convex shapes.
+	 */
+	struct ConvexPenetration
+	{
+		/**
+		 * The direction in which the second shape must move to leave the first one, in world space.
+		 */
+		Vec3 normal = Vec3(0);
+		Real depth = 0;
+		/**
+		 * The deepest point of each shape inside the other one.
+		 */
+		Vec3 pointOne = Vec3(0);
+		Vec3 pointTwo = Vec3(0);
+	};
+
+	/**
+	 * @brief Queries on any pair of convex colliders, only using their support function.
+	 *
+	 * The GJK algorithm looks for the point of the Minkowski difference of the shapes (i.e. one - two) closest to the origin,
+	 * the shapes overlap when the difference contains the origin.
+	 * The EPA algorithm then grows a polytope inside the difference until it finds the face closest to the origin,
+	 * which gives the penetration depth and normal.
+	 */
+	class GJK
+	{
+	public:
+		static bool Intersect(const PrimitiveCollider& one, const PrimitiveCollider& two);
+		static ConvexDistance Distance(const PrimitiveCollider& one, const PrimitiveCollider& two);
+		static ConvexDistance Distance(const Vec3& point, const PrimitiveCollider& shape);
+
+		/**
+		 * @return Whether the shapes overlap, in which case the penetration is filled.
+		 */
+		static bool Penetration(const PrimitiveCollider& one, const PrimitiveCollider& two, ConvexPenetration& penetration);
+		static bool Penetration(const Vec3& point, const PrimitiveCollider& shape, ConvexPenetration& penetration);
+	};
+
+} // namespace Voxymore::Core
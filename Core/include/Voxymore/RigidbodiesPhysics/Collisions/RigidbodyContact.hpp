@@ -6,6 +6,7 @@
 
 #include "Voxymore/Core/Core.hpp"
 #include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include <entt/entt.hpp>
 
 namespace Voxymore::Core
 {
@@ -17,6 +18,12 @@ namespace Voxymore::Core
 
 		std::array<Rigidbody*, 2> bodies;
 
+		/**
+		 * The entities owning the bodies, in the same order.
+		 * Unlike the bodies that live in the registry storage and move with it, they stay the same from one frame to the other.
+		 */
+		std::array<entt::entity, 2> entities = {entt::null, entt::null};
+
 		/**
 		 * Holds the position of the contact in world coordinates.
 		 */
@@ -36,6 +43,12 @@ namespace Voxymore::Core
 
 		Real restitution;
 
+		/**
+		 * Identify the features (vertex, edge, face) of the colliders that generated the contact.
+		 * Used with the entities to find the same contact from one frame to the other.
+		 */
+		uint32_t feature = 0;
+
 		void SetBodyData(Rigidbody* one, Rigidbody* two, Real friction, Real restitution);
 	};
 
@@ -43,8 +56,8 @@ namespace Voxymore::Core
 	{
 		CollisionData();
 		~CollisionData();
-		Real friction;
-		Real restitution;
+		Real friction = 0.5;
+		Real restitution = 0.2;
 
 		void AddContact(int i = 1);
 		[[deprecated("use CollisionData::AddContact")]]
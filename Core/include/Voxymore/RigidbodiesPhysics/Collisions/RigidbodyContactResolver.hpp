@@ -5,14 +5,102 @@
 #pragma once
 
 #include "RigidbodyContact.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyJoint.hpp"
 #include "Voxymore/Core/TimeStep.hpp"
+#include "Voxymore/Core/MultiThreading.hpp"
 #include "Voxymore/Math/Math.hpp"
+#include <array>
+#include <unordered_map>
+#include <vector>
 
 namespace Voxymore::Core
 {
+		class RigidbodyIslands;
 
+		/**
+		 * Identify a contact from one frame to the other.
+		 * Keyed on the entities (version included) as the bodies are moved in memory by the registry.
+		 */
+		struct RigidbodyContactKey
+		{
+			entt::entity one = entt::null;
+			entt::entity two = entt::null;
+			uint32_t feature = 0;
+
+			[[nodiscard]] inline bool operator==(const RigidbodyContactKey& other) const
+			{
+				return one == other.one && two == other.two && feature == other.feature;
+			}
+		};
+
+		struct RigidbodyContactKeyHash
+		{
+			[[nodiscard]] size_t operator()(const RigidbodyContactKey& key) const;
+		};
+
+		/**
+		 * The impulses applied on a contact at the end of a frame, used to warm start the same contact on the next one.
+		 */
+		struct RigidbodyContactImpulse
+		{
+			Real normalImpulse = 0;
+			// The friction impulse in world space as the tangents of the contact might change from one frame to the other.
+			Vec3 tangentImpulse = Vec3(0);
+		};
+
+		/**
+		 * @brief Sequential impulse contact solver.
+		 *
+		 * Each contact is solved as a velocity constraint along its normal (clamped to be only pushing)
+		 * and two tangents (clamped by the friction cone).
+		 * The penetration is resolved with a Baumgarte bias and the restitution is added to that bias.
+		 * The impulses of the previous frame are applied first (warm starting) so stacks converge in a few iterations.
+		 * The islands don't share any body with a finite mass, so they are solved in parallel on the job system.
+		 *
+		 * The joints are split in scalar rows (one per constrained direction) solved in the same iterations,
+		 * right before the contacts, with the same Baumgarte bias and warm starting.
+		 */
 		class RigidbodyContactResolver
 		{
+		private:
+			struct ContactConstraint
+			{
+				std::array<Rigidbody*, 2> bodies;
+				std::array<Mat3, 2> inverseInertia;
+				std::array<Real, 2> inverseMass;
+				// Vectors from the center of the bodies to the contact point.
+				std::array<Vec3, 2> relativePositions;
+				Vec3 normal;
+				std::array<Vec3, 2> tangents;
+				Real normalMass;
+				std::array<Real, 2> tangentMass;
+				Real bias;
+				Real friction;
+				Real normalImpulse;
+				std::array<Real, 2> tangentImpulse;
+				RigidbodyContactKey key;
+			};
+
+			/**
+			 * One direction constrained by a joint.
+			 * The relative velocity along the row is dot(linear, v0 - v1) + dot(angular[0], w0) + dot(angular[1], w1).
+			 */
+			struct JointRow
+			{
+				std::array<Rigidbody*, 2> bodies;
+				std::array<Mat3, 2> inverseInertia;
+				std::array<Real, 2> inverseMass;
+				Vec3 linear;
+				std::array<Vec3, 2> angular;
+				Real mass;
+				// The relative velocity the row tries to reach.
+				Real bias;
+				// The bounds of the accumulated impulse, a rope can only pull.
+				Real lowerImpulse;
+				Real upperImpulse;
+				Real impulse;
+				RigidbodyContactKey key;
+			};
 			protected:
 			uint32_t iterations;
 			uint32_t iterationsUsed;
@@ -22,8 +110,73 @@ namespace Voxymore::Core
 			inline ~RigidbodyContactResolver() = default;
 
 			void SetIterations(uint32_t iterations);
+			[[nodiscard]] inline uint32_t GetIterationsUsed() const { return iterationsUsed; }
+
+			void SetWarmStarting(bool warmStarting);
+			[[nodiscard]] inline bool IsWarmStarting() const { return m_WarmStarting; }
+
+			/**
+			 * @brief Forget the impulses of the previous frame. Must be called when the bodies are not the same anymore (i.e. new scene).
+			 */
+			void ClearCache();
+
+			void ResolveContacts(TimeStep ts, std::vector<RigidbodyContact>& contacts, const std::vector<RigidbodyJoint>& joints = {});
+
+			/**
+			 * @brief Resolve the contacts and joints island by island, the islands being solved concurrently on the job system.
+			 * @param islands The islands built from the same contacts and joints.
+			 */
+			void ResolveContacts(TimeStep ts, std::vector<RigidbodyContact>& contacts, const std::vector<RigidbodyJoint>& joints, const RigidbodyIslands& islands, JobSystem& jobSystem);
+		private:
+			void PrepareContacts(Real ts, const std::vector<RigidbodyContact>& contacts);
+			void PrepareJoints(Real ts, const std::vector<RigidbodyJoint>& joints);
+			void AddLinearRow(const RigidbodyJoint& joint, uint32_t row, const Vec3& direction, Real error, Real ts, Real lowerImpulse = -REAL_MAX, Real upperImpulse = REAL_MAX);
+			void AddAngularRow(const RigidbodyJoint& joint, uint32_t row, const Vec3& axis, Real error, Real ts);
+			/**
+			 * @brief Sort the constraints and the joint rows by island, keeping their order inside each island, and fill the island ranges.
+			 */
+			void SortByIsland(const RigidbodyIslands& islands);
+			/**
+			 * @return The number of iterations used to solve the contacts [begin, end) and the joint rows [jointBegin, jointEnd).
+			 */
+			uint32_t SolveRange(size_t begin, size_t end, size_t jointBegin, size_t jointEnd);
+			void WarmStart(size_t begin, size_t end, size_t jointBegin, size_t jointEnd);
+			/**
+			 * @return The biggest change of impulse of the iteration.
+			 */
+			Real SolveVelocities(size_t begin, size_t end, size_t jointBegin, size_t jointEnd);
+			void StoreImpulses();
+
+			static void ApplyImpulse(ContactConstraint& constraint, const Vec3& impulse);
+			[[nodiscard]] static Vec3 GetRelativeVelocity(const ContactConstraint& constraint);
+			[[nodiscard]] static Real GetEffectiveMass(const ContactConstraint& constraint, const Vec3& direction);
+			static void ApplyImpulse(JointRow& row, Real impulse);
+			[[nodiscard]] static Real GetRowVelocity(const JointRow& row);
+		private:
+			std::vector<ContactConstraint> m_Constraints;
+			std::vector<uint32_t> m_ConstraintIslands;
+			// The constraints of the island i are [m_IslandRanges[i], m_IslandRanges[i+1]).
+			std::vector<size_t> m_IslandRanges;
+			std::vector<JointRow> m_JointRows;
+			// The joint rows of the island i are [m_JointIslandRanges[i], m_JointIslandRanges[i+1]).
+			std::vector<size_t> m_JointIslandRanges;
+			std::vector<JobHandle> m_Jobs;
+			std::vector<uint32_t> m_JobIterations;
+			std::unordered_map<RigidbodyContactKey, RigidbodyContactImpulse, RigidbodyContactKeyHash> m_Cache;
+			// The impulse of each joint row, keyed by the bodies of the joint and the index of the row.
+			std::unordered_map<RigidbodyContactKey, Real, RigidbodyContactKeyHash> m_JointCache;
+			bool m_WarmStarting = true;
 
-			void ResolveContacts(TimeStep ts, std::vector<RigidbodyContact>& contacts);
+			// Ratio of the penetration resolved each step.
+			Real m_Baumgarte = 0.2;
+			// Penetration allowed to keep the contacts alive from one frame to the other.
+			Real m_Slop = 0.005;
+			// Under this separating speed, the restitution is ignored so the resting bodies don't jitter.
+			Real m_RestitutionThreshold = 1.0;
+			// Stop the iterations once no impulse changes more than this.
+			Real m_Tolerance = 1e-5;
+			// Consecutive islands are grouped in a job until it has this many constraints, so small islands aren't dominated by the scheduling cost.
+			size_t m_MinConstraintsPerJob = 64;
 		};
 
 } // namespace Voxymore::Core
@@ -0,0 +1,114 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/Math/BoundingBox.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadPhase.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BVHNodePool.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Sort and sweep broadphase on the endpoints of the fat boxes along a single axis.
+	 *
+	 * The endpoints are kept sorted from one frame to the other with an insertion sort,
+	 * which is close to linear as the bodies barely move between two frames.
+	 * The axis is the one on which the centers of the proxies are the most spread,
+	 * which works well on scenes where the bodies are laid out along one or two axes.
+	 */
+	class SweepAndPrune : public BroadPhase
+	{
+	private:
+		struct Proxy
+		{
+			BoundingBox box;
+			Rigidbody* body = nullptr;
+			Entity entity = Entity();
+			CollisionFilter filter;
+			// Used as the 'next' proxy when the proxy is in the free list.
+			uint32_t next = NullNode;
+			// Index of the proxy in the active list during the sweep.
+			uint32_t activeIndex = NullNode;
+			bool alive = false;
+			bool isStatic = false;
+		};
+
+		struct Endpoint
+		{
+			Real value;
+			uint32_t proxy;
+			bool isMin;
+
+			[[nodiscard]] inline bool operator<(const Endpoint& other) const
+			{
+				if(value != other.value) return value < other.value;
+				// The min are processed first so touching boxes are considered overlapping, like BoundingBox::Overlaps.
+				if(isMin != other.isMin) return isMin;
+				return proxy < other.proxy;
+			}
+		};
+	public:
+		SweepAndPrune(Real margin = 0.1, Real displacementMultiplier = 2);
+		~SweepAndPrune() override = default;
+	public:
+		uint32_t CreateProxy(const BoundingBox& box, Rigidbody* body, Entity entity, const CollisionFilter& filter, bool isStatic) override;
+		void DestroyProxy(uint32_t proxy) override;
+		bool MoveProxy(uint32_t proxy, const BoundingBox& box, const Vec3& displacement) override;
+		void SetProxyBody(uint32_t proxy, Rigidbody* body) override;
+		void SetProxyFilter(uint32_t proxy, const CollisionFilter& filter) override;
+		void SetProxyStatic(uint32_t proxy, bool isStatic) override;
+
+		[[nodiscard]] const BoundingBox& GetFatBoundingBox(uint32_t proxy) const override;
+		[[nodiscard]] inline uint32_t GetProxyCount() const override { return m_ProxyCount; }
+
+		uint32_t GetPotentialContacts(std::vector<PotentialContact>& contacts) override;
+		/**
+		 * @brief Walk the sorted endpoints up to the end of the box on the sweep axis.
+		 */
+		uint32_t QueryProxies(const BoundingBox& box, std::vector<std::pair<Rigidbody*, Entity>>& bodies) override;
+
+		void Clear() override;
+
+		[[nodiscard]] inline BroadPhaseType GetType() const override { return BroadPhaseType::SweepAndPrune; }
+		[[nodiscard]] inline int GetAxis() const { return m_Axis; }
+	private:
+		/**
+		 * @brief Change the sweep axis if another one spread the proxies a lot more than the current one.
+		 * @return Whether the axis changed.
+		 */
+		bool UpdateAxis();
+		/**
+		 * @brief Remove the endpoints of the destroyed proxies in a single pass and recycle the proxies.
+		 */
+		void RemoveDestroyedProxies();
+		/**
+		 * @brief Bring the endpoints up to date with the boxes of the proxies and sort them.
+		 * @param fullSort Whether the endpoints must be sorted from scratch, i.e. when the axis changed.
+		 */
+		void SortEndpoints(bool fullSort);
+		void UpdateEndpoints();
+		void InsertionSort();
+		[[nodiscard]] Real GetValue(const Endpoint& endpoint) const;
+	private:
+		std::vector<Proxy> m_Proxies;
+		std::vector<Endpoint> m_Endpoints;
+		std::vector<uint32_t> m_Active;
+		std::vector<uint64_t> m_Pairs;
+		// Destroyed proxies whose endpoints are still in the list, they are only recycled once the endpoints are removed.
+		std::vector<uint32_t> m_DestroyedProxies;
+		uint32_t m_FreeList = NullNode;
+		uint32_t m_ProxyCount = 0;
+		uint32_t m_AddedEndpoints = 0;
+		int m_Axis = 0;
+		// Whether the endpoints match the boxes of the proxies and are sorted.
+		bool m_EndpointsSorted = true;
+	};
+
+} // namespace Voxymore::Core
+
@@ -7,6 +7,7 @@
 #include "Voxymore/Components/CustomComponent.hpp"
 #include "Voxymore/Components/Components.hpp"
 #include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/CollisionFilter.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
 #include "Voxymore/Math/BoundingSphere.hpp"
 #include "Voxymore/Math/BoundingBox.hpp"
@@ -18,12 +19,15 @@ namespace Voxymore::Core
 	struct ColliderComponent : public SelfAwareComponent<ColliderComponent>
 	{
 		VXM_IMPLEMENT_SELFAWARECOMPONENT(ColliderComponent);
+		static constexpr bool ConcurrentDeserialization = true;
 	public:
 		inline ColliderComponent() = default;
 		inline ~ColliderComponent() = default;
 
 		void DeserializeComponent(YAML::Node& node, Entity e);
 		void SerializeComponent(YAML::Emitter& out, Entity e);
+		void DeserializeComponent(BinaryReader& reader, Entity e);
+		void SerializeComponent(BinaryWriter& writer, Entity e);
 		bool OnImGuiRender(Entity e);
 	public:
 
@@ -47,7 +51,8 @@ namespace Voxymore::Core
 		void SetRigidbody(RigidbodyComponent* rc);
 
 
-		std::variant<Sphere, Plane, Box> m_Collider;
+		std::variant<Sphere, Plane, Box, ConvexHull> m_Collider;
+		CollisionFilter m_Filter;
 	};
 
 } // namespace Voxymore::Core
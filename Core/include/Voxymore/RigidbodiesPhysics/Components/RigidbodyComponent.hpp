@@ -18,6 +18,8 @@ namespace Voxymore::Core
 	public:
 		void DeserializeComponent(YAML::Node& node, Entity entity);
 		void SerializeComponent(YAML::Emitter& out, Entity entity);
+		void DeserializeComponent(BinaryReader& reader, Entity entity);
+		void SerializeComponent(BinaryWriter& writer, Entity entity);
 		bool OnImGuiRender(Entity entity);
 
 		inline RigidbodyComponent() = default;
@@ -30,6 +30,7 @@ namespace Voxymore::Core
 	class RigidbodyFloatingComponent : public Component<RigidbodyFloatingComponent>
 	{
 		VXM_IMPLEMENT_COMPONENT(RigidbodyFloatingComponent);
+		static constexpr bool ConcurrentDeserialization = true;
 	public:
 		RigidbodyFloatingComponent() = default;
 		~RigidbodyFloatingComponent() = default;
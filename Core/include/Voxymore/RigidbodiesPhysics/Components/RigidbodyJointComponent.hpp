@@ -0,0 +1,86 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Components/Components.hpp"
+#include "Voxymore/Components/CustomComponent.hpp"
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyJoint.hpp"
+#include "Voxymore/Scene/Entity.hpp"
+
+#ifndef VXM_DEFAULT_JOINT_TYPE
+#define VXM_DEFAULT_JOINT_TYPE (JointType::BallSocket)
+#endif
+
+#ifndef VXM_DEFAULT_JOINT_LENGTH
+#define VXM_DEFAULT_JOINT_LENGTH ((Real)1.0)
+#endif
+
+#ifndef VXM_DEFAULT_JOINT_AXIS
+#define VXM_DEFAULT_JOINT_AXIS (Vec3{0,1,0})
+#endif
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Attach the rigidbody of the entity to another entity, or to a point of the world.
+	 *
+	 * Unlike the RigidbodySpringComponent, the joint is not a force but a constraint solved with the contacts,
+	 * so stiff assemblies (chains, cranes, ...) stay stable at the normal timestep.
+	 */
+	class RigidbodyJointComponent : public Component<RigidbodyJointComponent>
+	{
+		VXM_IMPLEMENT_COMPONENT(RigidbodyJointComponent);
+	public:
+		RigidbodyJointComponent() = default;
+		~RigidbodyJointComponent() = default;
+
+		void DeserializeComponent(YAML::Node& node);
+		void SerializeComponent(YAML::Emitter& out);
+		bool OnImGuiRender();
+
+		/**
+		 * @return Whether the joint is attached to another entity rather than to the world.
+		 */
+		[[nodiscard]] inline bool HasConnectedEntity() { return ConnectedEntity.Valid(); }
+	private:
+		std::string ConnectedEntityName;
+	public:
+		JointType Type = VXM_DEFAULT_JOINT_TYPE;
+
+		/**
+		 * The entity the joint is attached to. If not set, the joint is attached to the world.
+		 */
+		EntityField ConnectedEntity = EntityField(UUID(0), UUID(0));
+
+		/**
+		 * The anchor in the local space of the entity.
+		 */
+		Vec3 LocalAnchor = Vec3(0);
+
+		/**
+		 * The anchor in the local space of the connected entity, or in world space when attached to the world.
+		 */
+		Vec3 ConnectedAnchor = Vec3(0);
+
+		/**
+		 * The hinge axis in the local space of the entity.
+		 */
+		Vec3 Axis = VXM_DEFAULT_JOINT_AXIS;
+
+		/**
+		 * The hinge axis in the local space of the connected entity, or in world space when attached to the world.
+		 */
+		Vec3 ConnectedAxis = VXM_DEFAULT_JOINT_AXIS;
+
+		/**
+		 * The distance of the distance joints and the maximum length of the ropes.
+		 */
+		Real Length = VXM_DEFAULT_JOINT_LENGTH;
+	};
+
+} // namespace Voxymore::Core
+
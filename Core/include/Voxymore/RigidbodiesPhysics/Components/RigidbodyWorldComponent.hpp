@@ -0,0 +1,110 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Components/CustomComponent.hpp"
+#include "Voxymore/Core/FixedTimeStep.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadPhase.hpp"
+
+#ifndef VXM_DEFAULT_BROADPHASE
+#define VXM_DEFAULT_BROADPHASE (BroadPhaseType::DynamicBVH)
+#endif
+
+#ifndef VXM_DEFAULT_SOLVER_ITERATIONS
+#define VXM_DEFAULT_SOLVER_ITERATIONS 10
+#endif
+
+#ifndef VXM_DEFAULT_WARM_STARTING
+#define VXM_DEFAULT_WARM_STARTING true
+#endif
+
+#ifndef VXM_DEFAULT_ALLOW_SLEEPING
+#define VXM_DEFAULT_ALLOW_SLEEPING true
+#endif
+
+#ifndef VXM_DEFAULT_SLEEP_LINEAR_VELOCITY
+#define VXM_DEFAULT_SLEEP_LINEAR_VELOCITY 0.05
+#endif
+
+#ifndef VXM_DEFAULT_SLEEP_ANGULAR_VELOCITY
+#define VXM_DEFAULT_SLEEP_ANGULAR_VELOCITY 2
+#endif
+
+#ifndef VXM_DEFAULT_TIME_TO_SLEEP
+#define VXM_DEFAULT_TIME_TO_SLEEP 0.5
+#endif
+
+namespace Voxymore::Core
+{
+
+	/**
+	 * @brief The settings of the rigidbody simulation of the scene it's in.
+	 * Only one entity of the scene should have this component, the first one found is used.
+	 */
+	class RigidbodyWorldComponent : public Component<RigidbodyWorldComponent>
+	{
+		VXM_IMPLEMENT_COMPONENT(RigidbodyWorldComponent);
+	public:
+		RigidbodyWorldComponent() = default;
+		~RigidbodyWorldComponent() = default;
+	public:
+		void DeserializeComponent(YAML::Node& node);
+		void SerializeComponent(YAML::Emitter& out);
+		bool OnImGuiRender();
+	public:
+		/**
+		 * The algorithm used to find the potential contacts of the scene.
+		 */
+		BroadPhaseType BroadPhaseAlgorithm = VXM_DEFAULT_BROADPHASE;
+
+		/**
+		 * The maximum number of iterations of the contact solver each frame.
+		 */
+		int SolverIterations = VXM_DEFAULT_SOLVER_ITERATIONS;
+
+		/**
+		 * Whether the contact solver starts from the impulses of the previous frame.
+		 */
+		bool WarmStarting = VXM_DEFAULT_WARM_STARTING;
+
+		/**
+		 * The duration of a step of the simulation in seconds, independent of the frame rate.
+		 */
+		Real FixedDeltaTime = VXM_DEFAULT_FIXED_DELTA_TIME;
+
+		/**
+		 * The maximum number of steps simulated in one frame, the time above is dropped.
+		 */
+		int MaxSubSteps = VXM_DEFAULT_MAX_SUB_STEPS;
+
+		/**
+		 * Whether the transforms are interpolated between the last two steps for the rendering.
+		 */
+		bool Interpolate = VXM_DEFAULT_PHYSICS_INTERPOLATION;
+
+		/**
+		 * Whether the islands of bodies at rest are put to sleep and skipped by the simulation.
+		 */
+		bool AllowSleeping = VXM_DEFAULT_ALLOW_SLEEPING;
+
+		/**
+		 * The linear velocity (in m/s) under which a body is considered at rest.
+		 */
+		Real SleepLinearVelocity = VXM_DEFAULT_SLEEP_LINEAR_VELOCITY;
+
+		/**
+		 * The angular velocity (in degrees/s) under which a body is considered at rest.
+		 */
+		Real SleepAngularVelocity = VXM_DEFAULT_SLEEP_ANGULAR_VELOCITY;
+
+		/**
+		 * The time (in seconds) every body of an island must stay at rest before the island is put to sleep.
+		 */
+		Real TimeToSleep = VXM_DEFAULT_TIME_TO_SLEEP;
+	};
+
+} // namespace Voxymore::Core
+
@@ -5,13 +5,37 @@
 #pragma once
 
 #include "Voxymore/Math/Math.hpp"
+#include "Voxymore/Math/QuickHull.hpp"
+#include "Voxymore/Math/BoundingBox.hpp"
+#include "Voxymore/Math/BoundingSphere.hpp"
 #include "Voxymore/Components/Components.hpp"
 #include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include <array>
+#include <vector>
 
 namespace Voxymore::Core
 {
 	class Rigidbody;
 
+	/**
+	 * @brief A flat face of a collider in world space, used to clip the contact manifolds.
+	 */
+	struct SupportFace
+	{
+		/**
+		 * The outward normal of the face.
+		 */
+		Vec3 normal = Vec3(0);
+		/**
+		 * The corners of the face, in order around the normal.
+		 */
+		std::vector<Vec3> points;
+		/**
+		 * An id of the face unique in the collider.
+		 */
+		uint32_t index = 0;
+	};
+
 	class PrimitiveCollider
 	{
 	public:
@@ -19,6 +43,7 @@ namespace Voxymore::Core
 			Sphere,
 			Plane,
 			Box,
+			ConvexHull,
 		};
 	public:
 		Rigidbody* m_Body = nullptr;
@@ -38,6 +63,17 @@ namespace Voxymore::Core
 		 * If the provided index is invalid, the behavior is undefined.
 		 */
 		[[nodiscard]] Vec3 GetAxis(int32_t i) const;
+
+		/**
+		 * @brief The point of the collider the furthest in the direction, in world space, used by the GJK and EPA queries.
+		 * @note The default implementation returns the position, the unbounded colliders (i.e. the planes) are not supported.
+		 */
+		[[nodiscard]] virtual Vec3 Support(const Vec3& direction) const;
+		/**
+		 * @brief The face of the collider whose normal is the most aligned with the direction, in world space.
+		 * @return Whether the collider has a face, the default implementation has none (i.e. the spheres).
+		 */
+		virtual bool GetSupportFace(const Vec3& direction, SupportFace& face) const;
 	protected:
 		Mat4 m_CachedMatrix = Math::Identity<Mat4>();
 	};
@@ -46,6 +82,8 @@ namespace Voxymore::Core
 	{
 	public:
 		Real m_Radius = .5;
+
+		[[nodiscard]] Vec3 Support(const Vec3& direction) const override;
 	};
 
 	class Plane : public PrimitiveCollider
@@ -61,5 +99,68 @@ namespace Voxymore::Core
 		Vec3 m_HalfSize = {.5,.5,.5};
 
 		[[nodiscard]] std::array<Vec3, 8> GetVertices() const;
+		[[nodiscard]] Vec3 Support(const Vec3& direction) const override;
+		bool GetSupportFace(const Vec3& direction, SupportFace& face) const override;
+	};
+
+	/**
+	 * @brief The convex hull of a set of points, usually the vertices of a mesh.
+	 *
+	 * The hull is computed when the points are set, only its vertices and faces are kept.
+	 * A flat set of points has no faces and is only known through its support function.
+	 */
+	class ConvexHull : public PrimitiveCollider
+	{
+	public:
+		using Face = ConvexPolyhedron::Face;
+	public:
+		ConvexHull();
+
+		/**
+		 * @brief Replace the points of the hull, only the vertices of their convex hull are kept.
+		 */
+		void SetVertices(std::vector<Vec3> points);
+		/**
+		 * @return The vertices of the hull in the local space of the collider.
+		 */
+		[[nodiscard]] inline const std::vector<Vec3>& GetLocalVertices() const { return m_Vertices; }
+		/**
+		 * @return The faces of the hull in the local space of the collider.
+		 */
+		[[nodiscard]] inline const std::vector<Face>& GetFaces() const { return m_Faces; }
+		/**
+		 * @return The points of the hull in world space.
+		 */
+		[[nodiscard]] std::vector<Vec3> GetVertices() const;
+		/**
+		 * @return The world space box around the local bounds of the hull, without going through the vertices.
+		 */
+		[[nodiscard]] BoundingBox GetBoundingBox() const;
+		/**
+		 * @return The world space sphere around the local bounds of the hull, without going through the vertices.
+		 */
+		[[nodiscard]] BoundingSphere GetBoundingSphere() const;
+		/**
+		 * @return The world space center of the sphere inscribed in the hull, the average of its vertices.
+		 */
+		[[nodiscard]] Vec3 GetInnerCenter() const;
+		/**
+		 * @return The radius of the sphere around the inner center inside the hull, 0 for a flat hull.
+		 */
+		[[nodiscard]] Real GetInnerRadius() const;
+		[[nodiscard]] Vec3 Support(const Vec3& direction) const override;
+		bool GetSupportFace(const Vec3& direction, SupportFace& face) const override;
+	private:
+		void CacheBounds();
+	private:
+		std::vector<Vec3> m_Vertices;
+		std::vector<Face> m_Faces;
+		Vec3 m_LocalMin = Vec3(0);
+		Vec3 m_LocalMax = Vec3(0);
+		// The distance of the furthest vertex to the center of the local bounds.
+		Real m_LocalRadius = 0;
+		Vec3 m_LocalInnerCenter = Vec3(0);
+		// The distance of the inner center to the closest face.
+		Real m_LocalInnerRadius = 0;
 	};
 } // namespace Voxymore::Core
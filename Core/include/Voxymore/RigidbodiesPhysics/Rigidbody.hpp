@@ -30,13 +30,17 @@ namespace Voxymore::Core
 		 *
 		 * This method updates the position and orientation of the rigid body based on
 		 * its current state and the specified time step.
+		 * The accumulated forces are kept, so they apply on every fixed step of the frame, and cleared by the physics layer once the frame is simulated.
 		 *
 		 * @param ts The time step for integration.
 		 */
 		void Integrate(Real ts);
 	public:
-		Mat4 CalculateTransformMatrix() const;
-		Mat3 CalculateWorldInverseInertiaTensor() const;
+		[[nodiscard]] const Mat4& CalculateTransformMatrix() const;
+		/**
+		 * @brief The inverse inertia tensor rotated in world space, cached until the orientation or the tensor change.
+		 */
+		[[nodiscard]] const Mat3& CalculateWorldInverseInertiaTensor() const;
 
 		void SetInertiaTensor(const Mat3& inertiaTensor);
 		void SetInverseInertiaTensor(const Mat3& inverseInertiaTensor);
@@ -85,7 +89,37 @@ namespace Voxymore::Core
 		void SetAngularVelocity(const Vec3& angularVelocity);
 		void AddAngularVelocity(const Vec3& angularVelocity);
 
+		/**
+		 * @brief Whether the body is simulated. A sleeping body isn't integrated and only wakes up when touched by an awake body, when its velocity is set or when a force would change its velocity above the sleep thresholds within a step.
+		 */
+		[[nodiscard]] bool IsAwake() const;
+		/**
+		 * @brief Wake up or put the body to sleep. A body going to sleep loses its velocities and accumulated forces.
+		 * Waking up an awake body does nothing, its sleep timer only restarts when it moves faster than the thresholds.
+		 */
+		void SetAwake(bool awake = true);
+
+		/**
+		 * @brief Accumulate the time the body has been moving slower than the thresholds.
+		 * @param angularThreshold The threshold on the angular velocity, in degrees per seconds.
+		 */
+		void UpdateSleepTime(Real ts, Real linearThreshold, Real angularThreshold);
+		[[nodiscard]] Real GetSleepTime() const;
+
+		/**
+		 * @brief Whether the movement of the body is swept against the other colliders so it cannot tunnel through them when moving fast.
+		 */
+		[[nodiscard]] bool IsContinuous() const;
+		void SetContinuous(bool continuous);
+
 	protected:
+		/**
+		 * @brief Wake up a sleeping body if the velocity changes over a step are above the sleep thresholds.
+		 * @param angularVelocityChange The change of angular velocity, in degrees per seconds like the angular threshold.
+		 * @return Whether the body is awake.
+		 */
+		bool TryWakeUp(const Vec3& linearVelocityChange, const Vec3& angularVelocityChange);
+
 
 		/**
 		 * Holds the inverse of the body's inertia tensor. The
@@ -149,7 +183,7 @@ namespace Voxymore::Core
 		 * The torques resulting from forces applied at specific points on the body during the physics simulation are accumulated into m_TorqueAccumulate.
 		 * Once the simulation step is done, the accumulated torque is used to update the state of the Rigidbody, specifically its angular velocity.
 		 *
-		 * Typically, m_TorqueAccumulate is cleared after each simulation step so it can accept and accumulate new torques in the next step.
+		 * m_TorqueAccumulate is cleared once all the simulation steps of a frame are done so it can accept and accumulate the torques of the next frame.
 		 * The clearing is done by calling the 'ClearAccumulator()' method in the physics engine updates.
 		 */
 		Vec3 m_TorqueAccumulate = Vec3(0.0);
@@ -182,6 +216,37 @@ namespace Voxymore::Core
 		* This is a scalar value, with its unit being force time per radian.
 		*/
 		Real m_AngularDamping = 0.9;
+
+		/**
+		 * The time, in seconds, the body has been moving slower than the sleep thresholds.
+		 */
+		Real m_SleepTime = 0;
+
+		/**
+		 * The sleep thresholds of the last UpdateSleepTime, under which the forces and velocities don't wake the body up.
+		 */
+		Real m_SleepLinearThreshold = 0;
+		Real m_SleepAngularThreshold = 0;
+		/**
+		 * The time step of the last UpdateSleepTime, used to turn the forces into velocity changes.
+		 */
+		Real m_SleepTimeStep = 0;
+
+		bool m_IsAwake = true;
+
+		bool m_Continuous = false;
+
+		/**
+		 * @brief The inverse inertia tensor in world space, recomputed only when the local tensor or the transform changed.
+		 */
+		mutable Mat3 m_CachedWorldInverseInertiaTensor = Math::Identity<Mat3>();
+		mutable uint64_t m_CachedInertiaVersion = UINT64_MAX;
+	protected:
+		/**
+		 * @brief Force the next call to CalculateWorldInverseInertiaTensor to recompute the tensor.
+		 * Must be called when m_InverseInertiaTensor is modified directly.
+		 */
+		inline void InvalidateInertiaCache() { m_CachedInertiaVersion = UINT64_MAX; }
 	};
 
 } // namespace Voxymore::Core
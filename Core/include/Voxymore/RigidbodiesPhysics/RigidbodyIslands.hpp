@@ -0,0 +1,68 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContact.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyJoint.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Group the bodies touching or jointed to each other (directly or through other bodies) in islands.
+	 *
+	 * The bodies with an infinite mass don't link the islands together,
+	 * otherwise every body resting on the same ground would be in the same island.
+	 */
+	class RigidbodyIslands
+	{
+	public:
+		RigidbodyIslands() = default;
+		~RigidbodyIslands() = default;
+	public:
+		/**
+		 * @brief Add a body that can be part of an island. Must be called for every body before Build.
+		 */
+		void AddBody(Rigidbody* body);
+
+		/**
+		 * @brief Merge the islands of the bodies of each contact and each joint.
+		 */
+		void Build(const std::vector<RigidbodyContact>& contacts, const std::vector<RigidbodyJoint>& joints = {});
+
+		void Clear();
+
+		[[nodiscard]] inline uint32_t GetIslandCount() const { return static_cast<uint32_t>(m_IslandOffsets.empty() ? 0 : m_IslandOffsets.size() - 1); }
+
+		/**
+		 * @return The bodies of the island, contiguous in memory.
+		 */
+		[[nodiscard]] std::pair<Rigidbody* const*, Rigidbody* const*> GetIsland(uint32_t island) const;
+
+		/**
+		 * @return The island of the body, or UINT32_MAX if the body hasn't been added.
+		 */
+		[[nodiscard]] uint32_t GetIslandIndex(const Rigidbody* body) const;
+	private:
+		void Link(Rigidbody* one, Rigidbody* two);
+		uint32_t Find(uint32_t body);
+		void Union(uint32_t a, uint32_t b);
+	private:
+		std::vector<Rigidbody*> m_Bodies;
+		std::unordered_map<const Rigidbody*, uint32_t> m_Indices;
+		std::vector<uint32_t> m_Parents;
+		std::vector<uint32_t> m_BodyIslands;
+
+		// The bodies sorted by island, the island i being [m_IslandOffsets[i], m_IslandOffsets[i+1]).
+		std::vector<Rigidbody*> m_IslandBodies;
+		std::vector<uint32_t> m_IslandOffsets;
+	};
+
+} // namespace Voxymore::Core
+
@@ -0,0 +1,63 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include <array>
+#include <entt/entt.hpp>
+#include <cstdint>
+
+namespace Voxymore::Core
+{
+	enum class JointType : int
+	{
+		/**
+		 * Keep the anchors at a fixed distance from each other.
+		 */
+		Distance,
+		/**
+		 * Keep the anchors at the same position, the bodies rotating freely around it.
+		 */
+		BallSocket,
+		/**
+		 * Keep the anchors at the same position and the axes aligned, the bodies only rotating around the axis.
+		 */
+		Hinge,
+		/**
+		 * Keep the anchors at most at a distance from each other, the rope being slack below it.
+		 */
+		Rope,
+	};
+
+	/**
+	 * @brief A joint between two bodies for one step of the simulation, everything in world space.
+	 * Solved by the RigidbodyContactResolver in the same iterations as the contacts.
+	 */
+	struct RigidbodyJoint
+	{
+		/**
+		 * The second body can be null, the joint is then attached to a fixed point of the world.
+		 */
+		std::array<Rigidbody*, 2> bodies = {nullptr, nullptr};
+		/**
+		 * The entities owning the bodies, used to find the same joint from one frame to the other.
+		 */
+		std::array<entt::entity, 2> entities = {entt::null, entt::null};
+		std::array<Vec3, 2> anchors = {Vec3(0), Vec3(0)};
+		/**
+		 * The hinge axis of each body, only used by the hinges.
+		 */
+		std::array<Vec3, 2> axes = {Vec3(0, 1, 0), Vec3(0, 1, 0)};
+		/**
+		 * The distance kept by the distance joints or the maximum length of the ropes.
+		 */
+		Real length = 1;
+		JointType type = JointType::BallSocket;
+	};
+
+} // namespace Voxymore::Core
+
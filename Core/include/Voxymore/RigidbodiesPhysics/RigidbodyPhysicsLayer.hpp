@@ -16,20 +16,55 @@
 #include "Voxymore/Events/ApplicationEvent.hpp"
 
 #include "Voxymore/Core/FileSystem.hpp"
+#include "Voxymore/Core/FixedTimeStep.hpp"
 #include "Voxymore/Scene/Scene.hpp"
+#include "Voxymore/Scene/TransformSnapshots.hpp"
 
 #include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContact.hpp"
 #include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContactResolver.hpp"
 #include "Voxymore/RigidbodiesPhysics/Collisions/BroadCollisions.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadPhase.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BoxOverlapBatch.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/CollisionDetector.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyIslands.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyJoint.hpp"
 
 
 namespace Voxymore::Core
 {
+	/**
+	 * @brief What the fixed steps cost since the last reset, summed over all the steps.
+	 */
+	struct RigidbodyPhysicsStats
+	{
+		// Time spent in each phase, in seconds.
+		double integrate = 0;
+		double broadphase = 0;
+		double narrowphase = 0;
+		double resolve = 0;
+
+		uint64_t steps = 0;
+		uint64_t potentialContacts = 0;
+		uint64_t contacts = 0;
+	};
 
 	class RigidbodyPhysicsLayer : public Layer
 	{
+	private:
+		struct ContinuousBody
+		{
+			entt::entity entity;
+			// The position of the body before the integration.
+			Vec3 start;
+		};
+
+		struct MovingProxy
+		{
+			std::pair<Rigidbody*, Entity> body;
+			uint32_t proxy;
+		};
 	public:
 		RigidbodyPhysicsLayer();
 		~RigidbodyPhysicsLayer() override;
@@ -46,20 +81,119 @@ namespace Voxymore::Core
 
 		void AddContact(const RigidbodyContact & contact);
 		void AddContacts(const std::vector<RigidbodyContact>& contacts);
+
+		[[nodiscard]] BroadPhaseType GetBroadPhaseType() const;
+
+		/**
+		 * @return The pairs involving a trigger whose colliders overlapped during the last step.
+		 */
+		[[nodiscard]] inline const std::vector<PotentialContact>& GetTriggerOverlaps() const { return m_TriggerOverlaps; }
+
+		/**
+		 * @brief Run a number of fixed steps right away, independently of the frame time.
+		 * Used to simulate without rendering (i.e. headless batches).
+		 */
+		void Simulate(uint32_t stepCount);
+
+		inline FixedTimeStep& GetFixedTimeStep() { return m_FixedTimeStep; }
+		[[nodiscard]] inline const FixedTimeStep& GetFixedTimeStep() const { return m_FixedTimeStep; }
+
+		inline void SetInterpolation(bool interpolate) { m_Interpolate = interpolate; }
+		[[nodiscard]] inline bool IsInterpolating() const { return m_Interpolate; }
+
+		[[nodiscard]] inline const RigidbodyPhysicsStats& GetStats() const { return m_Stats; }
+		inline void ResetStats() { m_Stats = RigidbodyPhysicsStats(); }
 	private:
 		[[nodiscard]] bool HasScene() const;
 
+		void LoadWorldSettings();
+		void ConnectScene();
+		void DisconnectScene();
+		void OnRemoveProxy(entt::entity e);
+
+		void SimulateStep(TimeStep ts);
+
+		void RestoreTransforms();
+		void SavePreviousTransforms();
+		void SaveCurrentTransforms();
+		void InterpolateTransforms(Real alpha);
+
 		void Integrate(TimeStep ts);
+		/**
+		 * @brief Clear the forces accumulated during the frame, once all its fixed steps are simulated (or none).
+		 */
+		void ClearForces();
+		void SaveContinuousStarts();
+		/**
+		 * @brief Sweep the continuous bodies from their start position and stop them at their first impact.
+		 * Each body is only swept against the planes and the proxies of the broadphase overlapping its swept box.
+		 */
+		void ContinuousCollisionCheck(TimeStep ts);
 		bool BroadCollisionCheck(TimeStep ts);
+		/**
+		 * @brief Pair the planes with the moving bodies whose fat box is partly behind them.
+		 * The planes are infinite and never inserted in the broadphase, they are tested analytically.
+		 */
+		void PlaneCollisionCheck();
 		bool FineCollisionCheck(TimeStep ts);
+		/**
+		 * @brief Test the trigger pairs found by the broadphase and keep the overlapping ones, no contact is created.
+		 */
+		void TriggerCheck();
+		/**
+		 * @brief Test the new box pairs of the potential contacts at once and remove the ones that don't overlap.
+		 * The pairs that already have a manifold are left to the narrowphase and the separating axis cached in it.
+		 */
+		void CullBoxPairs();
+		/**
+		 * @brief Fetch the manifold of each box pair of the potential contacts and forget the pairs that are not potential contacts anymore.
+		 */
+		void UpdateManifolds();
+		static void Collide(PotentialContact& potentialContact, CollisionData* contacts, BoxManifold* manifold);
 		void CollisionResolution(TimeStep ts);
+		void WakeTouchedBodies();
+		/**
+		 * @brief Gather the joints of the step in world space, waking the sleeping bodies jointed to an awake one.
+		 */
+		void BuildJoints();
+		void BuildIslands();
+		void UpdateSleeping(TimeStep ts);
 	private:
 		Vec3 m_Gravity = Vec3(0.0, -9.8, 0.0);
 		Ref<Scene> m_SceneHandle = nullptr;
 		std::vector<PotentialContact> m_PotentialContacts {};
+		std::vector<PotentialContact> m_TriggerPairs;
+		std::vector<std::pair<Rigidbody*, Entity>> m_Planes;
+		std::vector<MovingProxy> m_MovingProxies;
+		std::vector<PotentialContact> m_TriggerOverlaps;
+		CollisionData m_TriggerContacts;
 		CollisionData m_Contacts;
+		std::vector<RigidbodyJoint> m_Joints;
+		std::vector<ContinuousBody> m_ContinuousBodies;
+		std::vector<RigidbodyContact> m_ContinuousContacts;
+		// The bodies of the broadphase a continuous body might hit during the step.
+		std::vector<std::pair<Rigidbody*, Entity>> m_ContinuousCandidates;
+		std::vector<CollisionData> m_ContactsBuffers;
+		BoxOverlapBatch m_BoxOverlaps;
+		// The index of the potential contacts added to m_BoxOverlaps.
+		std::vector<uint32_t> m_BoxOverlapPairs;
+		// The manifolds of the box pairs, keyed by the entities of the pair.
+		std::unordered_map<uint64_t, BoxManifold> m_BoxManifolds;
+		// The manifold of each potential contact, null if it's not a box pair.
+		std::vector<BoxManifold*> m_PairManifolds;
+		uint64_t m_ManifoldStep = 0;
 		RigidbodyContactResolver m_Resolver;
-		BVHNode<BoundingSphere>* m_Root = nullptr;
+		Scope<BroadPhase> m_BroadPhase;
+		std::unordered_map<entt::entity, uint32_t> m_Proxies;
+		FixedTimeStep m_FixedTimeStep;
+		TransformSnapshots m_Snapshots;
+		bool m_Interpolate = VXM_DEFAULT_PHYSICS_INTERPOLATION;
+		RigidbodyIslands m_Islands;
+		bool m_AllowSleeping = VXM_DEFAULT_ALLOW_SLEEPING;
+		Real m_SleepLinearVelocity = VXM_DEFAULT_SLEEP_LINEAR_VELOCITY;
+		Real m_SleepAngularVelocity = VXM_DEFAULT_SLEEP_ANGULAR_VELOCITY;
+		Real m_TimeToSleep = VXM_DEFAULT_TIME_TO_SLEEP;
+		RigidbodyPhysicsStats m_Stats;
 	};
 
 } // namespace Voxymore::Core
@@ -8,6 +8,7 @@
 #include "Voxymore/Core/TimeStep.hpp"
 #include "Voxymore/Math/Math.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
+#include "Voxymore/Scene/ForceAccumulator.hpp"
 #include "Voxymore/Scene/Systems.hpp"
 #include "static_block.hpp"
 
@@ -22,6 +23,8 @@ namespace Voxymore::Core
 		~RigidbodySpringSystem() = default;
 	public:
 		virtual void Update(Scene& scene, TimeStep ts) override;
+	private:
+		ForceAccumulator m_Forces;
 	};
 
 } // namespace Voxymore::Core
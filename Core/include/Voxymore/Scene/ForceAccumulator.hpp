@@ -0,0 +1,85 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Collect the forces emitted by a system running in parallel and apply them afterward in a deterministic order.
+	 *
+	 * Each thread writes its records in its own buffer, so the emission doesn't need any lock.
+	 * Reduce then sorts all the records by target, source and order before handing them out,
+	 * so the forces are summed in the same order whatever the number of threads or the scheduling.
+	 */
+	class ForceAccumulator
+	{
+	public:
+		struct ForceRecord
+		{
+			entt::entity target;
+			// The entity emitting the force and the index of the force among the ones it emitted, to sort the records.
+			entt::entity source;
+			uint32_t order;
+			Vec3 force;
+			Vec3 point;
+			bool atPoint;
+		};
+	public:
+		ForceAccumulator();
+		~ForceAccumulator() = default;
+
+		ForceAccumulator(const ForceAccumulator&) = delete;
+		ForceAccumulator& operator=(const ForceAccumulator&) = delete;
+	public:
+		/**
+		 * @brief Record a force applied at the center of mass of the target. Thread-safe.
+		 */
+		void AddForce(entt::entity source, uint32_t order, entt::entity target, const Vec3& force);
+
+		/**
+		 * @brief Record a force applied at a point in world space of the target. Thread-safe.
+		 */
+		void AddForceAtPoint(entt::entity source, uint32_t order, entt::entity target, const Vec3& force, const Vec3& point);
+
+		/**
+		 * @brief Call the function on every record in a deterministic order and clear the buffers.
+		 * Must not be called while some threads are still emitting forces.
+		 * @param func The function called as func(const ForceRecord&).
+		 */
+		template<typename Func>
+		void Reduce(Func&& func)
+		{
+			VXM_PROFILE_FUNCTION();
+			Gather();
+			for (const ForceRecord& record : m_Sorted)
+			{
+				func(record);
+			}
+			m_Sorted.clear();
+		}
+	private:
+		std::vector<ForceRecord>& GetLocalBuffer();
+		void Gather();
+	private:
+		// Unique for each accumulator, to know if the buffer cached by a thread belongs to this accumulator.
+		uint64_t m_Id;
+		std::mutex m_BuffersMutex;
+		std::unordered_map<std::thread::id, std::unique_ptr<std::vector<ForceRecord>>> m_Buffers;
+		std::vector<ForceRecord> m_Sorted;
+	};
+
+} // namespace Voxymore::Core
+
@@ -17,6 +17,7 @@
 #include <entt/entt.hpp>
 #include <algorithm>
 #include <execution>
+#include <type_traits>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -165,12 +166,62 @@ namespace Voxymore::Core
 		template<typename... Get, typename... Exclude>
 		[[nodiscard]] entt::basic_view<entt::get_t<entt::storage_for_t<Get>...>, entt::exclude_t<entt::storage_for_t<Exclude>...>> view(entt::exclude_t<Exclude...> ex);
 
+		/**
+		 * @brief Get the sink of the signal emitted when a component of type T is added to an entity.
+		 *
+		 * Allow the layers to keep their own data synchronized with the registry
+		 * without having access to the registry itself.
+		 *
+		 * @tparam T The type of the component to listen to.
+		 * @return The sink on which a listener can connect or disconnect.
+		 */
+		template<typename T>
+		[[nodiscard]] auto on_construct();
+
+		/**
+		 * @brief Get the sink of the signal emitted when a component of type T is removed from an entity.
+		 *
+		 * @tparam T The type of the component to listen to.
+		 * @return The sink on which a listener can connect or disconnect.
+		 */
+		template<typename T>
+		[[nodiscard]] auto on_destroy();
+
+		/**
+		 * @brief Copy all the components of type T of the source scene on the same entities of this scene.
+		 *
+		 * The entities must have been created in this scene with the same handles as in the source (i.e. by the copy of the scene).
+		 * The components are copied in the order of the source storage so the systems iterate them in the same order.
+		 *
+		 * @tparam T The type of the component to copy.
+		 * @param source The scene to copy the components from.
+		 */
+		template<typename T>
+		void CloneStorage(const Scene& source);
+
+		/**
+		 * @brief Reserve the room for more entities, with their ID, tag and transform components.
+		 * @param count The number of entities about to be created.
+		 */
+		void ReserveEntities(size_t count);
+
+		/**
+		 * @brief Reserve the room for more components of type T.
+		 * @param count The number of components about to be added.
+		 */
+		template<typename T>
+		void ReserveStorage(size_t count);
+
 	private:
 		template<typename T>
 		inline void OnComponentAdded(entt::entity entity, T& component) {}
 		template<typename T>
 		inline void OnEmptyComponentAdded(entt::entity entity) {}
 		void InitScene();
+		/**
+		 * @brief Replace the entities of this scene by a copy of the entities of the source, keeping their handles and UUIDs.
+		 */
+		void Clone(const Scene& source);
 		void OnCreateIDComponent(entt::entity);
 		void OnDestroyIDComponent(entt::entity);
 	public:
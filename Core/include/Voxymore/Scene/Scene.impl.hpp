@@ -134,4 +134,55 @@ namespace Voxymore::Core
 		VXM_PROFILE_FUNCTION();
 		return m_Registry.view<Get ...>(ex);
 	}
+
+	/**
+		 * @brief Get the sink of the signal emitted when a component of type T is added to an entity.
+		 *
+		 * @tparam T The type of the component to listen to.
+		 * @return The sink on which a listener can connect or disconnect.
+		 */
+	template<typename T>
+	[[nodiscard]] inline auto Scene::on_construct()
+	{
+		return m_Registry.on_construct<T>();
+	}
+
+	/**
+		 * @brief Get the sink of the signal emitted when a component of type T is removed from an entity.
+		 *
+		 * @tparam T The type of the component to listen to.
+		 * @return The sink on which a listener can connect or disconnect.
+		 */
+	template<typename T>
+	[[nodiscard]] inline auto Scene::on_destroy()
+	{
+		return m_Registry.on_destroy<T>();
+	}
+
+	template<typename T>
+	inline void Scene::CloneStorage(const Scene& source)
+	{
+		VXM_PROFILE_FUNCTION();
+		const auto view = source.m_Registry.view<const T>();
+		// The view iterates the storage backward, the reverse iteration emplaces the components in the packed order of the source.
+		for (auto it = view.rbegin(); it != view.rend(); ++it)
+		{
+			if constexpr (std::is_empty_v<T>)
+			{
+				m_Registry.emplace<T>(*it);
+			}
+			else
+			{
+				m_Registry.emplace<T>(*it, source.m_Registry.get<T>(*it));
+			}
+		}
+	}
+
+	template<typename T>
+	inline void Scene::ReserveStorage(size_t count)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto& storage = m_Registry.storage<T>();
+		storage.reserve(storage.size() + count);
+	}
 }
\ No newline at end of file
@@ -23,14 +23,33 @@ namespace Voxymore::Core
 
 		bool Serialize(const Path& filePath) const;
 		bool Serialize(const std::filesystem::path& filePath) const;
-		// TODO: Add 'SerializeRuntime' using Voxymore::Core::Path.
+		/**
+		 * @brief Write the scene in the binary runtime format.
+		 * YAML stays the editor format, the runtime format is the cooked one, it is read through a memory mapping without any parsing.
+		 */
+		bool SerializeRuntime(const Path& filePath) const;
 		bool SerializeRuntime(const std::filesystem::path& filePath) const;
 
+		/**
+		 * @brief Read a scene, in the YAML format or in the runtime format.
+		 */
 		bool Deserialize(const Path& filePath);
 		bool Deserialize(const std::filesystem::path& filePath);
-		// TODO: Add 'DeserializeRuntime' using Voxymore::Core::Path.
+		/**
+		 * @brief Read a scene like Deserialize, spreading the work on the job system.
+		 * The YAML document is parsed once then the entities are read by batches on the workers,
+		 * each batch being added to the scene on the calling thread as soon as it is ready.
+		 * Only the components declaring a ConcurrentDeserialization are deserialized on the workers.
+		 */
+		bool DeserializeParallel(const Path& filePath);
+		bool DeserializeParallel(const std::filesystem::path& filePath);
+		bool DeserializeRuntime(const Path& filePath, bool deserializeId = true);
 		bool DeserializeRuntime(const std::filesystem::path& filePath, bool deserializeId = true);
 		static std::optional<UUID> GetSceneID(const std::filesystem::path& filePath);
+		/**
+		 * @return Whether the file starts like a scene in the runtime format.
+		 */
+		static bool IsRuntimeScene(const std::filesystem::path& filePath);
 	public:
 		void ChangeSceneTarget(const Ref<Scene>& scene);
 		void ChangeSceneTarget(Scene* scene);
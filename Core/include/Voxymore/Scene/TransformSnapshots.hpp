@@ -0,0 +1,71 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/Math/Math.hpp"
+#include "Voxymore/Components/Components.hpp"
+#include <entt/entt.hpp>
+#include <unordered_map>
+
+namespace Voxymore::Core
+{
+	/**
+	 * @brief Keep the pose of the simulated entities at the last two fixed steps so the rendering can interpolate between them.
+	 *
+	 * Between two frames, the TransformComponent holds the interpolated pose used for the rendering.
+	 * Restore puts back the simulated pose before the next steps,
+	 * unless the transform has been changed by someone else in-between, in which case the new pose is kept (teleport).
+	 */
+	class TransformSnapshots
+	{
+	private:
+		struct Snapshot
+		{
+			Vec3 previousPosition;
+			Quat previousRotation;
+			Vec3 currentPosition;
+			Quat currentRotation;
+			// The pose written in the transform by the last interpolation.
+			Vec3 renderedPosition;
+			Quat renderedRotation;
+		};
+	public:
+		TransformSnapshots() = default;
+		~TransformSnapshots() = default;
+	public:
+		/**
+		 * @brief Put back the simulated pose in the transform before stepping the simulation.
+		 */
+		void Restore(entt::entity entity, TransformComponent& transform);
+
+		/**
+		 * @brief Keep the current pose of the transform as the pose before the last step of the frame.
+		 */
+		void SavePrevious(entt::entity entity, const TransformComponent& transform);
+		void SavePrevious(entt::entity entity, const Vec3& position, const Quat& rotation);
+
+		/**
+		 * @brief Keep the current pose of the transform as the simulated pose, once all the steps of the frame are done.
+		 */
+		void SaveCurrent(entt::entity entity, const TransformComponent& transform);
+		void SaveCurrent(entt::entity entity, const Vec3& position, const Quat& rotation);
+
+		/**
+		 * @brief Write the pose between the previous and the current one in the transform.
+		 * @param alpha The ratio between the previous (0) and the current (1) pose.
+		 */
+		void Interpolate(entt::entity entity, TransformComponent& transform, Real alpha);
+
+		void Remove(entt::entity entity);
+		void Clear();
+
+		[[nodiscard]] inline size_t size() const { return m_Snapshots.size(); }
+	private:
+		std::unordered_map<entt::entity, Snapshot> m_Snapshots;
+	};
+
+} // namespace Voxymore::Core
+
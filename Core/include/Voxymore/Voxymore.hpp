@@ -61,6 +61,7 @@
 #include "Voxymore/RigidbodiesPhysics/RigidbodyPhysicsLayer.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodySpringComponent.hpp"
+#include "Voxymore/RigidbodiesPhysics/Components/RigidbodyJointComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Systems/RigidbodySpringSystem.hpp"
 #include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContact.hpp"
 #include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContactResolver.hpp"
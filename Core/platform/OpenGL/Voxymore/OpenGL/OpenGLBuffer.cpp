@@ -25,6 +25,13 @@ namespace Voxymore::Core {
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
+    void OpenGLVertexBuffer::GetData(void* data, uint32_t size) const {
+        VXM_PROFILE_FUNCTION();
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glGetBufferSubData(GL_ARRAY_BUFFER, 0, (long)size, data);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
     OpenGLVertexBuffer::~OpenGLVertexBuffer() {
         VXM_PROFILE_FUNCTION();
         glDeleteBuffers(1, &m_RendererID);
@@ -17,6 +17,7 @@ namespace Voxymore::Core {
 
         inline virtual void SetLayout(const BufferLayout& layout) override {m_Layout = layout;}
         inline virtual const BufferLayout& GetLayout() const override {return m_Layout;}
+        virtual void GetData(void* data, uint32_t size) const override;
 
         OpenGLVertexBuffer(const OpenGLVertexBuffer &) = delete;
         OpenGLVertexBuffer &operator=(const OpenGLVertexBuffer &) = delete;
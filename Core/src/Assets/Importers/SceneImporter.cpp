@@ -24,7 +24,7 @@ namespace Voxymore::Core
 		VXM_CORE_ASSERT(IsScene(metadata.FilePath), "The asset '{0}' is not a scene", metadata.FilePath.string());
 		Ref<Scene> scene = CreateRef<Scene>();
 		SceneSerializer serializer(scene);
-		serializer.Deserialize(metadata.FilePath);
+		serializer.DeserializeParallel(metadata.FilePath);
 		return scene;
 	}
 
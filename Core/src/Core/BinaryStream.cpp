@@ -0,0 +1,92 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Core/BinaryStream.hpp"
+#include "Voxymore/Debug/Profiling.hpp"
+#include <fstream>
+
+namespace Voxymore::Core
+{
+	void BinaryWriter::WriteString(const std::string& value)
+	{
+		Write<uint32_t>(static_cast<uint32_t>(value.size()));
+		WriteBytes(value.data(), value.size());
+	}
+
+	void BinaryWriter::WriteBytes(const void* data, size_t size)
+	{
+		if(size == 0) return;
+		size_t offset = m_Buffer.size();
+		m_Buffer.resize(offset + size);
+		std::memcpy(m_Buffer.data() + offset, data, size);
+	}
+
+	bool BinaryWriter::WriteToFile(const std::filesystem::path& path) const
+	{
+		VXM_PROFILE_FUNCTION();
+		if(path.has_parent_path()) std::filesystem::create_directories(path.parent_path());
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if(!file) return false;
+		file.write(reinterpret_cast<const char*>(m_Buffer.data()), static_cast<std::streamsize>(m_Buffer.size()));
+		return file.good();
+	}
+
+	bool BinaryReader::Request(size_t size)
+	{
+		if(m_Failed || size > Remaining())
+		{
+			m_Failed = true;
+			return false;
+		}
+		return true;
+	}
+
+	void BinaryReader::ReadBytes(void* data, size_t size)
+	{
+		if(size == 0) return;
+		if(!Request(size)) return;
+		std::memcpy(data, m_Data.data() + m_Offset, size);
+		m_Offset += size;
+	}
+
+	std::string BinaryReader::ReadString()
+	{
+		auto size = Read<uint32_t>();
+		if(!Request(size)) return {};
+		std::string value(reinterpret_cast<const char*>(m_Data.data() + m_Offset), size);
+		m_Offset += size;
+		return value;
+	}
+
+	void BinaryReader::Skip(size_t size)
+	{
+		if(!Request(size)) return;
+		m_Offset += size;
+	}
+
+	BinaryReader BinaryReader::SubReader(size_t size)
+	{
+		if(!Request(size))
+		{
+			BinaryReader failed;
+			failed.m_Failed = true;
+			return failed;
+		}
+		BinaryReader reader(m_Data.subspan(m_Offset, size));
+		m_Offset += size;
+		return reader;
+	}
+
+	BinaryReader BinaryReader::SubReader(size_t offset, size_t size)
+	{
+		if(m_Failed || offset > m_Data.size() || size > m_Data.size() - offset)
+		{
+			BinaryReader failed;
+			failed.m_Failed = true;
+			return failed;
+		}
+		return {m_Data.subspan(offset, size)};
+	}
+} // namespace Voxymore::Core
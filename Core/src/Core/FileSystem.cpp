@@ -61,6 +61,17 @@ namespace Voxymore::Core
 		return ifstream;
 	}
 
+	MappedFile FileSystem::MapFile(const Path& path)
+	{
+		VXM_PROFILE_FUNCTION();
+		MappedFile file(GetPath(path));
+		if(!file)
+		{
+			VXM_CORE_ERROR("Could not open file '{0}'.", path.GetFullPath().string());
+		}
+		return file;
+	}
+
 	std::stringstream FileSystem::ReadFileAsStringStream(const Path& path)
 	{
 		VXM_PROFILE_FUNCTION();
@@ -0,0 +1,59 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Core/FixedTimeStep.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Voxymore::Core
+{
+	FixedTimeStep::FixedTimeStep(TimeType fixedDeltaTime, uint32_t maxSubSteps) : m_FixedDeltaTime(fixedDeltaTime), m_MaxSubSteps(maxSubSteps)
+	{
+		VXM_CORE_ASSERT(m_FixedDeltaTime > 0, "The fixed delta time must be positive.");
+	}
+
+	uint32_t FixedTimeStep::Advance(TimeStep frameTime)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Accumulator += std::max(frameTime.GetSeconds(), (TimeType)0);
+
+		uint32_t count = static_cast<uint32_t>(m_Accumulator / m_FixedDeltaTime);
+		if(count > m_MaxSubSteps)
+		{
+			// Too late to catch up, the simulation drops the time it cannot afford.
+			count = m_MaxSubSteps;
+			m_Accumulator = std::fmod(m_Accumulator, m_FixedDeltaTime);
+		}
+		else
+		{
+			m_Accumulator -= m_FixedDeltaTime * (TimeType)count;
+		}
+
+		m_SimulatedTime += (double)m_FixedDeltaTime * (double)count;
+		return count;
+	}
+
+	void FixedTimeStep::Reset()
+	{
+		m_Accumulator = 0;
+		m_SimulatedTime = 0;
+	}
+
+	TimeType FixedTimeStep::GetAlpha() const
+	{
+		return std::clamp(m_Accumulator / m_FixedDeltaTime, (TimeType)0, (TimeType)1);
+	}
+
+	void FixedTimeStep::SetFixedDeltaTime(TimeType fixedDeltaTime)
+	{
+		VXM_CORE_ASSERT(fixedDeltaTime > 0, "The fixed delta time must be positive.");
+		if(fixedDeltaTime <= 0) return;
+		m_FixedDeltaTime = fixedDeltaTime;
+	}
+
+	void FixedTimeStep::SetMaxSubSteps(uint32_t maxSubSteps)
+	{
+		m_MaxSubSteps = maxSubSteps;
+	}
+} // namespace Voxymore::Core
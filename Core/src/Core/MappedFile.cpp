@@ -0,0 +1,164 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Core/MappedFile.hpp"
+#include "Voxymore/Core/Logger.hpp"
+#include "Voxymore/Debug/Profiling.hpp"
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Voxymore::Core
+{
+	MappedFile::MappedFile(const std::filesystem::path& path)
+	{
+		Open(path);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+	{
+		Swap(other);
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if(this != &other)
+		{
+			Close();
+			Swap(other);
+		}
+		return *this;
+	}
+
+	void MappedFile::Swap(MappedFile& other) noexcept
+	{
+		std::swap(m_Data, other.m_Data);
+		std::swap(m_Size, other.m_Size);
+		std::swap(m_IsOpen, other.m_IsOpen);
+		std::swap(m_File, other.m_File);
+#if defined(_WIN32)
+		std::swap(m_Mapping, other.m_Mapping);
+#endif
+	}
+
+#if defined(_WIN32)
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		VXM_PROFILE_FUNCTION();
+		Close();
+
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if(file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER size;
+		if(!GetFileSizeEx(file, &size))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		m_File = file;
+		m_Size = static_cast<size_t>(size.QuadPart);
+		m_IsOpen = true;
+
+		// A file mapping of size 0 cannot be created.
+		if(m_Size == 0) return true;
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(!mapping)
+		{
+			VXM_CORE_ERROR("Could not map the file '{0}'.", path.string());
+			Close();
+			return false;
+		}
+		m_Mapping = mapping;
+
+		m_Data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if(!m_Data)
+		{
+			VXM_CORE_ERROR("Could not map the file '{0}'.", path.string());
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_Data) UnmapViewOfFile(m_Data);
+		if(m_Mapping) CloseHandle(m_Mapping);
+		if(m_File) CloseHandle(m_File);
+		m_Data = nullptr;
+		m_Mapping = nullptr;
+		m_File = nullptr;
+		m_Size = 0;
+		m_IsOpen = false;
+	}
+#else
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		VXM_PROFILE_FUNCTION();
+		Close();
+
+		int file = ::open(path.c_str(), O_RDONLY);
+		if(file < 0) return false;
+
+		struct stat status{};
+		if(::fstat(file, &status) != 0)
+		{
+			::close(file);
+			return false;
+		}
+
+		m_File = file;
+		m_Size = static_cast<size_t>(status.st_size);
+		m_IsOpen = true;
+
+		// A mapping of size 0 is invalid.
+		if(m_Size == 0) return true;
+
+		void* data = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+		if(data == MAP_FAILED)
+		{
+			VXM_CORE_ERROR("Could not map the file '{0}'.", path.string());
+			Close();
+			return false;
+		}
+		// The whole file is read, let the OS read ahead.
+		::madvise(data, m_Size, MADV_SEQUENTIAL);
+		m_Data = static_cast<const uint8_t*>(data);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_Data) ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+		if(m_File >= 0) ::close(m_File);
+		m_Data = nullptr;
+		m_File = -1;
+		m_Size = 0;
+		m_IsOpen = false;
+	}
+#endif
+} // namespace Voxymore::Core
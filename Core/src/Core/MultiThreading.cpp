@@ -0,0 +1,205 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Core/MultiThreading.hpp"
+#include "Voxymore/Debug/Profiling.hpp"
+
+namespace Voxymore::Core
+{
+	namespace
+	{
+		// The worker running on this thread, to push and pop from its own deque.
+		thread_local const JobSystem* s_WorkerSystem = nullptr;
+		thread_local uint32_t s_WorkerIndex = 0;
+	}
+
+	JobSystem::JobSystem(uint32_t workerCount)
+	{
+		if(workerCount == 0)
+		{
+			// The thread waiting on the jobs runs them too.
+			workerCount = std::max(thread_count(), 2u) - 1;
+		}
+
+		m_Queues.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i)
+		{
+			m_Queues.push_back(std::make_unique<WorkerQueue>());
+		}
+
+		m_Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i)
+		{
+			m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(m_SleepMutex);
+			m_Running.store(false, std::memory_order_release);
+		}
+		m_SleepCondition.notify_all();
+		for (std::thread& worker : m_Workers)
+		{
+			if(worker.joinable()) worker.join();
+		}
+	}
+
+	JobSystem& JobSystem::Get()
+	{
+		static JobSystem s_JobSystem;
+		return s_JobSystem;
+	}
+
+	JobHandle JobSystem::Schedule(std::function<void()> function, std::span<const JobHandle> dependencies)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto job = std::make_shared<Job>();
+		job->function = std::move(function);
+
+		for (const JobHandle& dependency : dependencies)
+		{
+			if(!dependency.m_Job) continue;
+			std::lock_guard lock(dependency.m_Job->mutex);
+			// Checked under the lock as the dependency publishes its completion under it.
+			if(dependency.m_Job->finished.load(std::memory_order_acquire)) continue;
+			job->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+			dependency.m_Job->continuations.push_back(job);
+		}
+
+		// Release the scheduling reference, the last dependency to finish pushes the job otherwise.
+		if(job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Push(job);
+		}
+		return JobHandle(std::move(job));
+	}
+
+	void JobSystem::WaitFor(const JobHandle& handle)
+	{
+		VXM_PROFILE_FUNCTION();
+		while (!handle.IsFinished())
+		{
+			if(!RunOne()) std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::WaitFor(std::span<const JobHandle> handles)
+	{
+		for (const JobHandle& handle : handles)
+		{
+			WaitFor(handle);
+		}
+	}
+
+	void JobSystem::WorkerLoop(uint32_t index)
+	{
+		s_WorkerSystem = this;
+		s_WorkerIndex = index;
+
+		while (true)
+		{
+			if(RunOne()) continue;
+
+			std::unique_lock lock(m_SleepMutex);
+			m_SleepCondition.wait(lock, [this]() {
+				return m_QueuedJobs.load(std::memory_order_acquire) > 0 || !m_Running.load(std::memory_order_acquire);
+			});
+			if(!m_Running.load(std::memory_order_acquire) && m_QueuedJobs.load(std::memory_order_acquire) == 0) break;
+		}
+
+		s_WorkerSystem = nullptr;
+	}
+
+	void JobSystem::Push(std::shared_ptr<Job> job)
+	{
+		if(m_Queues.empty())
+		{
+			// No worker, the job is run right away on the calling thread.
+			Execute(job);
+			return;
+		}
+
+		WorkerQueue& queue = *m_Queues[GetCurrentQueue()];
+		{
+			std::lock_guard lock(queue.mutex);
+			queue.jobs.push_back(std::move(job));
+		}
+
+		{
+			std::lock_guard lock(m_SleepMutex);
+			m_QueuedJobs.fetch_add(1, std::memory_order_release);
+		}
+		m_SleepCondition.notify_one();
+	}
+
+	std::shared_ptr<JobSystem::Job> JobSystem::Pop()
+	{
+		WorkerQueue& queue = *m_Queues[GetCurrentQueue()];
+		std::lock_guard lock(queue.mutex);
+		if(queue.jobs.empty()) return nullptr;
+		std::shared_ptr<Job> job = std::move(queue.jobs.back());
+		queue.jobs.pop_back();
+		return job;
+	}
+
+	std::shared_ptr<JobSystem::Job> JobSystem::Steal(uint32_t thief)
+	{
+		const uint32_t count = static_cast<uint32_t>(m_Queues.size());
+		for (uint32_t i = 1; i <= count; ++i)
+		{
+			WorkerQueue& queue = *m_Queues[(thief + i) % count];
+			std::lock_guard lock(queue.mutex);
+			if(queue.jobs.empty()) continue;
+			std::shared_ptr<Job> job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+			return job;
+		}
+		return nullptr;
+	}
+
+	bool JobSystem::RunOne()
+	{
+		if(m_Queues.empty()) return false;
+
+		std::shared_ptr<Job> job = Pop();
+		if(!job) job = Steal(GetCurrentQueue());
+		if(!job) return false;
+
+		m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+		Execute(job);
+		return true;
+	}
+
+	void JobSystem::Execute(const std::shared_ptr<Job>& job)
+	{
+		if(job->function) job->function();
+		// The function might hold resources captured by value, release them as soon as possible.
+		job->function = nullptr;
+
+		std::vector<std::shared_ptr<Job>> continuations;
+		{
+			std::lock_guard lock(job->mutex);
+			job->finished.store(true, std::memory_order_release);
+			continuations.swap(job->continuations);
+		}
+
+		for (std::shared_ptr<Job>& continuation : continuations)
+		{
+			if(continuation->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				Push(std::move(continuation));
+			}
+		}
+	}
+
+	uint32_t JobSystem::GetCurrentQueue() const
+	{
+		if(s_WorkerSystem == this) return s_WorkerIndex;
+		// The threads outside of the pool spread their jobs over the workers.
+		return m_NextQueue.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(m_Queues.size());
+	}
+} // namespace Voxymore::Core
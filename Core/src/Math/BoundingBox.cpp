@@ -75,6 +75,34 @@ namespace Voxymore::Core
 		m_Max += movement;
 	}
 
+	void BoundingBox::Inflate(Real margin)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Min -= Vec3(margin);
+		m_Max += Vec3(margin);
+	}
+
+	void BoundingBox::Stretch(const Vec3 &displacement)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Min = glm::min(m_Min, m_Min + displacement);
+		m_Max = glm::max(m_Max, m_Max + displacement);
+	}
+
+	bool BoundingBox::Contains(const BoundingBox &other) const
+	{
+		VXM_PROFILE_FUNCTION();
+		return m_Min.x <= other.m_Min.x && m_Min.y <= other.m_Min.y && m_Min.z <= other.m_Min.z
+			&& other.m_Max.x <= m_Max.x && other.m_Max.y <= m_Max.y && other.m_Max.z <= m_Max.z;
+	}
+
+	Real BoundingBox::GetSurfaceArea() const
+	{
+		VXM_PROFILE_FUNCTION();
+		auto size = m_Max - m_Min;
+		return (Real)2 * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
 	Vec3 BoundingBox::GetCenter() const
 	{
 		VXM_PROFILE_FUNCTION();
@@ -0,0 +1,363 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Math/QuickHull.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <unordered_map>
+
+namespace Voxymore::Core
+{
+	namespace
+	{
+		// The tolerance of the distance to the faces, relative to the size of the point cloud.
+		constexpr Real s_RelativeTolerance = 1e-5;
+		// The cosine above which the normals of two neighbouring triangles can be part of the same face.
+		constexpr Real s_CoplanarCosine = 1 - 1e-4;
+
+		struct Triangle
+		{
+			std::array<uint32_t, 3> vertices;
+			Vec3 normal;
+			Real offset;
+			// The points outside of the triangle, which it's the furthest from.
+			std::vector<uint32_t> outside;
+			// The last search the triangle was reached by.
+			uint32_t visit = 0;
+			bool alive = true;
+			bool visible = false;
+
+			[[nodiscard]] inline Real Distance(const Vec3& point) const { return Math::Dot(normal, point) - offset; }
+		};
+
+		class HullBuilder
+		{
+		public:
+			HullBuilder(const std::vector<Vec3>& points, Real epsilon) : m_Points(points), m_Epsilon(epsilon) {}
+
+			bool Build()
+			{
+				VXM_PROFILE_FUNCTION();
+				std::array<uint32_t, 4> simplex;
+				if(!FindSimplex(simplex)) return false;
+
+				m_Interior = (m_Points[simplex[0]] + m_Points[simplex[1]] + m_Points[simplex[2]] + m_Points[simplex[3]]) * (Real)0.25;
+				const uint32_t first = static_cast<uint32_t>(m_Triangles.size());
+				AddTriangle(simplex[0], simplex[1], simplex[2]);
+				AddTriangle(simplex[0], simplex[1], simplex[3]);
+				AddTriangle(simplex[0], simplex[2], simplex[3]);
+				AddTriangle(simplex[1], simplex[2], simplex[3]);
+
+				std::vector<uint32_t> points;
+				points.reserve(m_Points.size());
+				for (uint32_t i = 0; i < m_Points.size(); ++i)
+				{
+					if(std::find(simplex.begin(), simplex.end(), i) == simplex.end()) points.push_back(i);
+				}
+				AssignPoints(points, first);
+
+				for (uint32_t i = 0; i < m_Triangles.size(); ++i)
+				{
+					// The triangles are appended as the hull grows, so this loop reaches the new ones too.
+					if(!m_Triangles[i].alive || m_Triangles[i].outside.empty()) continue;
+					AddPoint(i);
+				}
+				return true;
+			}
+
+			void Export(ConvexPolyhedron& hull) const
+			{
+				VXM_PROFILE_FUNCTION();
+				// Only the points used by a face are kept.
+				std::vector<uint32_t> remap(m_Points.size(), UINT32_MAX);
+				auto getVertex = [&](uint32_t point)
+				{
+					if(remap[point] == UINT32_MAX)
+					{
+						remap[point] = static_cast<uint32_t>(hull.vertices.size());
+						hull.vertices.push_back(m_Points[point]);
+					}
+					return remap[point];
+				};
+
+				// Each face grows from a triangle to its neighbours lying on the same plane.
+				std::vector<uint8_t> merged(m_Triangles.size(), 0);
+				std::vector<uint32_t> stack;
+				for (uint32_t seed = 0; seed < m_Triangles.size(); ++seed)
+				{
+					if(!m_Triangles[seed].alive || merged[seed]) continue;
+					const Triangle& seedTriangle = m_Triangles[seed];
+					ConvexPolyhedron::Face& face = hull.faces.emplace_back();
+					face.normal = seedTriangle.normal;
+					face.offset = seedTriangle.offset;
+
+					merged[seed] = 1;
+					stack.assign(1, seed);
+					while(!stack.empty())
+					{
+						const Triangle& triangle = m_Triangles[stack.back()];
+						stack.pop_back();
+						for (uint32_t i = 0; i < 3; ++i)
+						{
+							const uint32_t vertex = getVertex(triangle.vertices[i]);
+							if(std::find(face.vertices.begin(), face.vertices.end(), vertex) == face.vertices.end()) face.vertices.push_back(vertex);
+
+							auto twin = m_Edges.find(MakeEdge(triangle.vertices[(i + 1) % 3], triangle.vertices[i]));
+							if(twin == m_Edges.end() || merged[twin->second]) continue;
+							const Triangle& neighbour = m_Triangles[twin->second];
+							if(Math::Dot(neighbour.normal, face.normal) <= s_CoplanarCosine) continue;
+							const bool coplanar = std::all_of(neighbour.vertices.begin(), neighbour.vertices.end(), [&](uint32_t point) {
+								return Math::Abs(Math::Dot(face.normal, m_Points[point]) - face.offset) <= m_Epsilon;
+							});
+							if(!coplanar) continue;
+							merged[twin->second] = 1;
+							stack.push_back(twin->second);
+						}
+					}
+				}
+
+				for (ConvexPolyhedron::Face& face : hull.faces)
+				{
+					SortAroundNormal(face, hull.vertices);
+				}
+			}
+		private:
+			bool FindSimplex(std::array<uint32_t, 4>& simplex) const
+			{
+				// The two furthest apart of the extreme points on each axis.
+				std::array<uint32_t, 6> extremes = {0, 0, 0, 0, 0, 0};
+				for (uint32_t i = 1; i < m_Points.size(); ++i)
+				{
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						if(m_Points[i][axis] < m_Points[extremes[axis * 2]][axis]) extremes[axis * 2] = i;
+						if(m_Points[i][axis] > m_Points[extremes[axis * 2 + 1]][axis]) extremes[axis * 2 + 1] = i;
+					}
+				}
+
+				Real best = -1;
+				for (uint32_t i = 0; i < extremes.size(); ++i)
+				{
+					for (uint32_t j = i + 1; j < extremes.size(); ++j)
+					{
+						const Real distance = Math::SqrMagnitude(m_Points[extremes[i]] - m_Points[extremes[j]]);
+						if(distance > best)
+						{
+							best = distance;
+							simplex[0] = extremes[i];
+							simplex[1] = extremes[j];
+						}
+					}
+				}
+				if(best <= m_Epsilon * m_Epsilon) return false;
+
+				// The furthest from the line.
+				const Vec3 a = m_Points[simplex[0]];
+				const Vec3 ab = m_Points[simplex[1]] - a;
+				best = -1;
+				for (uint32_t i = 0; i < m_Points.size(); ++i)
+				{
+					const Real distance = Math::SqrMagnitude(Math::Cross(ab, m_Points[i] - a));
+					if(distance > best)
+					{
+						best = distance;
+						simplex[2] = i;
+					}
+				}
+				if(best <= Math::SqrMagnitude(ab) * m_Epsilon * m_Epsilon) return false;
+
+				// The furthest from the plane.
+				const Vec3 normal = Math::Normalize(Math::Cross(ab, m_Points[simplex[2]] - a));
+				best = -1;
+				for (uint32_t i = 0; i < m_Points.size(); ++i)
+				{
+					const Real distance = Math::Abs(Math::Dot(normal, m_Points[i] - a));
+					if(distance > best)
+					{
+						best = distance;
+						simplex[3] = i;
+					}
+				}
+				return best > m_Epsilon;
+			}
+
+			void AddTriangle(uint32_t a, uint32_t b, uint32_t c)
+			{
+				Triangle triangle;
+				triangle.vertices = {a, b, c};
+				triangle.normal = Math::Normalize(Math::Cross(m_Points[b] - m_Points[a], m_Points[c] - m_Points[a]));
+				// The hull always contains the center of the first tetrahedron, which must stay behind every face.
+				if(Math::Dot(triangle.normal, m_Interior - m_Points[a]) > 0)
+				{
+					std::swap(triangle.vertices[1], triangle.vertices[2]);
+					triangle.normal = -triangle.normal;
+				}
+				triangle.offset = Math::Dot(triangle.normal, m_Points[a]);
+
+				const uint32_t index = static_cast<uint32_t>(m_Triangles.size());
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					m_Edges[MakeEdge(triangle.vertices[i], triangle.vertices[(i + 1) % 3])] = index;
+				}
+				m_Triangles.push_back(std::move(triangle));
+			}
+
+			/**
+			 * @brief Give each point to the triangle from [first, end) it's the furthest outside of, the points inside all of them are dropped.
+			 */
+			void AssignPoints(const std::vector<uint32_t>& points, uint32_t first)
+			{
+				for (uint32_t point : points)
+				{
+					Real best = m_Epsilon;
+					uint32_t bestTriangle = UINT32_MAX;
+					for (uint32_t t = first; t < m_Triangles.size(); ++t)
+					{
+						const Real distance = m_Triangles[t].Distance(m_Points[point]);
+						if(distance > best)
+						{
+							best = distance;
+							bestTriangle = t;
+						}
+					}
+					if(bestTriangle != UINT32_MAX) m_Triangles[bestTriangle].outside.push_back(point);
+				}
+			}
+
+			void AddPoint(uint32_t triangleIndex)
+			{
+				// The furthest point outside of the triangle is always a vertex of the hull.
+				const Triangle& triangle = m_Triangles[triangleIndex];
+				uint32_t eye = triangle.outside[0];
+				Real best = triangle.Distance(m_Points[eye]);
+				for (uint32_t point : triangle.outside)
+				{
+					const Real distance = triangle.Distance(m_Points[point]);
+					if(distance > best)
+					{
+						best = distance;
+						eye = point;
+					}
+				}
+				const Vec3& eyePoint = m_Points[eye];
+
+				// The triangles the point can see, found from the first one through their edges.
+				// Any triangle the point is in front of is visible, even barely, so the hull never gets concave.
+				++m_Visit;
+				m_Visible.clear();
+				m_Stack.assign(1, triangleIndex);
+				while(!m_Stack.empty())
+				{
+					const uint32_t index = m_Stack.back();
+					m_Stack.pop_back();
+					Triangle& current = m_Triangles[index];
+					if(current.visit == m_Visit) continue;
+					current.visit = m_Visit;
+					if(index != triangleIndex && current.Distance(eyePoint) <= 0) continue;
+
+					current.visible = true;
+					m_Visible.push_back(index);
+					for (uint32_t i = 0; i < 3; ++i)
+					{
+						m_Stack.push_back(m_Edges.at(MakeEdge(current.vertices[(i + 1) % 3], current.vertices[i])));
+					}
+				}
+
+				// The horizon is made of the edges shared with a hidden triangle.
+				m_Horizon.clear();
+				m_Orphans.clear();
+				for (uint32_t index : m_Visible)
+				{
+					Triangle& visible = m_Triangles[index];
+					for (uint32_t i = 0; i < 3; ++i)
+					{
+						const uint32_t from = visible.vertices[i];
+						const uint32_t to = visible.vertices[(i + 1) % 3];
+						if(!m_Triangles[m_Edges.at(MakeEdge(to, from))].visible) m_Horizon.push_back(MakeEdge(from, to));
+					}
+					for (uint32_t point : visible.outside)
+					{
+						if(point != eye) m_Orphans.push_back(point);
+					}
+				}
+
+				for (uint32_t index : m_Visible)
+				{
+					Triangle& visible = m_Triangles[index];
+					visible.alive = false;
+					visible.visible = false;
+					for (uint32_t i = 0; i < 3; ++i)
+					{
+						m_Edges.erase(MakeEdge(visible.vertices[i], visible.vertices[(i + 1) % 3]));
+					}
+					visible.outside.clear();
+					visible.outside.shrink_to_fit();
+				}
+
+				const uint32_t first = static_cast<uint32_t>(m_Triangles.size());
+				for (uint64_t edge : m_Horizon)
+				{
+					AddTriangle(static_cast<uint32_t>(edge >> 32), static_cast<uint32_t>(edge), eye);
+				}
+				AssignPoints(m_Orphans, first);
+			}
+
+			[[nodiscard]] inline static uint64_t MakeEdge(uint32_t from, uint32_t to)
+			{
+				return (static_cast<uint64_t>(from) << 32) | to;
+			}
+
+			static void SortAroundNormal(ConvexPolyhedron::Face& face, const std::vector<Vec3>& vertices)
+			{
+				Vec3 center(0);
+				for (uint32_t vertex : face.vertices) center += vertices[vertex];
+				center /= (Real)face.vertices.size();
+
+				const Vec3 u = Math::Normalize(vertices[face.vertices[0]] - center);
+				const Vec3 v = Math::Cross(face.normal, u);
+				std::sort(face.vertices.begin(), face.vertices.end(), [&](uint32_t a, uint32_t b) {
+					const Vec3 da = vertices[a] - center;
+					const Vec3 db = vertices[b] - center;
+					return std::atan2(Math::Dot(da, v), Math::Dot(da, u)) < std::atan2(Math::Dot(db, v), Math::Dot(db, u));
+				});
+			}
+		private:
+			const std::vector<Vec3>& m_Points;
+			Real m_Epsilon;
+			Vec3 m_Interior = Vec3(0);
+			std::vector<Triangle> m_Triangles;
+			// The triangle of each directed edge of the hull, the triangle on the other side being the one of the reversed edge.
+			std::unordered_map<uint64_t, uint32_t> m_Edges;
+			std::vector<uint32_t> m_Visible;
+			std::vector<uint32_t> m_Stack;
+			std::vector<uint64_t> m_Horizon;
+			std::vector<uint32_t> m_Orphans;
+			uint32_t m_Visit = 0;
+		};
+	}
+
+	bool QuickHull::Compute(const std::vector<Vec3>& points, ConvexPolyhedron& hull)
+	{
+		VXM_PROFILE_FUNCTION();
+		hull = ConvexPolyhedron();
+		if(points.size() < 4) return false;
+
+		Vec3 min = points[0];
+		Vec3 max = points[0];
+		for (const Vec3& point : points)
+		{
+			min = Math::Min(min, point);
+			max = Math::Max(max, point);
+		}
+		const Vec3 size = max - min;
+		const Real epsilon = Math::Max(Math::Max(size.x, size.y), size.z) * s_RelativeTolerance;
+		if(epsilon <= 0) return false;
+
+		HullBuilder builder(points, epsilon);
+		if(!builder.Build()) return false;
+		builder.Export(hull);
+		return true;
+	}
+} // namespace Voxymore::Core
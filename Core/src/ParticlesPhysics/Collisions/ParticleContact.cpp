@@ -28,10 +28,16 @@ namespace Voxymore::Core
 	}
 
 	void ParticleContact::Resolve(TimeStep duration)
+	{
+		std::array<Vec3, 2> particleMovement;
+		Resolve(duration, particleMovement);
+	}
+
+	void ParticleContact::Resolve(TimeStep duration, std::array<Vec3, 2>& particleMovement)
 	{
 		VXM_PROFILE_FUNCTION();
 		ResolveVelocity(duration);
-		ResolveInterpenetration(duration);
+		ResolveInterpenetration(duration, particleMovement);
 	}
 
 	Real ParticleContact::CalculateSeparatingVelocity() const
@@ -101,9 +107,10 @@ namespace Voxymore::Core
 		}
 	}
 
-	void ParticleContact::ResolveInterpenetration(TimeStep duration)
+	void ParticleContact::ResolveInterpenetration(TimeStep duration, std::array<Vec3, 2>& particleMovement)
 	{
 		VXM_PROFILE_FUNCTION();
+		particleMovement = {Vec3(0), Vec3(0)};
 
 		if(penetration <= 0)
 		{
@@ -123,9 +130,8 @@ namespace Voxymore::Core
 			return;
 		}
 
-		Vec3 movePerIMass = contactNormal * (penetration * (penetration  / totalInverseMass));
+		Vec3 movePerIMass = contactNormal * (penetration / totalInverseMass);
 
-		std::array<Vec3, 2> particleMovement = {Vec3(0), Vec3(0)};
 		particleMovement[0] = movePerIMass * particles[0]->GetInverseMass();
 		if(particles[1])
 		{
@@ -3,46 +3,222 @@
 //
 
 #include "Voxymore/ParticlesPhysics/Collisions/ParticleContactResolver.hpp"
+#include <algorithm>
+#include <functional>
 
 namespace Voxymore::Core
 {
+	static constexpr uint32_t NotInHeap = UINT32_MAX;
+
 	ParticleContactResolver::ParticleContactResolver() : iterations(0), iterationsUsed(0) {}
 	ParticleContactResolver::ParticleContactResolver(uint32_t iterations) : iterations(iterations), iterationsUsed(0) {}
 
 	void ParticleContactResolver::ResolveContacts(TimeStep ts, std::vector<ParticleContact>& contacts)
 	{
-		uint32_t i;
+		VXM_PROFILE_FUNCTION();
 		iterationsUsed = 0;
 
-		VXM_CORE_CHECK(iterations <= 0, "No iteration will be done as iterations = {0}", iterations);
+		VXM_CORE_CHECK(iterations > 0, "No iteration will be done as iterations = {0}", iterations);
 		VXM_CORE_CHECK(iterations >= contacts.size(), "There is not enough iterations to cover all the m_Contacts... {0} iterations for {1} m_Contacts", iterations, contacts.size());
 
-		while (iterationsUsed < iterations)
+		if(contacts.empty()) return;
+
+		BuildLinks(contacts);
+		BuildHeap(contacts);
+
+		std::array<Vec3, 2> particleMovement;
+		while (iterationsUsed < iterations && !m_Heap.empty())
 		{
-			Real max = REAL_MAX;
-			uint32_t maxIndex = contacts.size();
-			for (i = 0; i < contacts.size(); ++i)
+			uint32_t index = m_Heap.front();
+			ParticleContact& contact = contacts[index];
+			contact.Resolve(ts, particleMovement);
+			++iterationsUsed;
+
+			// The resolution moved the particles of the contact,
+			// which changes the penetration and separating velocity of all the contacts sharing those particles.
+			for (uint32_t slot = 0; slot < 2; ++slot)
 			{
-				Real sepVel = contacts[i].CalculateSeparatingVelocity();
-				if(sepVel < max && (sepVel < 0 || contacts[0].penetration > 0))
+				if(!contact.particles[slot]) continue;
+				const Particle* particle = contact.particles[slot];
+				auto [begin, end] = m_LinkRanges[index][slot];
+				for (uint32_t i = begin; i < end; ++i)
 				{
-					max = sepVel;
-					maxIndex = i;
+					const ParticleLink& link = m_Links[i];
+					ParticleContact& other = contacts[link.contact];
+					if(link.contact != index)
+					{
+						if(other.particles[0] == particle) other.penetration -= Math::Dot(particleMovement[slot], other.contactNormal);
+						if(other.particles[1] == particle) other.penetration += Math::Dot(particleMovement[slot], other.contactNormal);
+					}
+					UpdateContact(contacts, link.contact);
 				}
 			}
 
-			if(maxIndex == contacts.size())
+			// The penetration has been fully resolved, don't let the rounding errors bring it back.
+			contact.penetration = 0;
+			UpdateContact(contacts, index);
+		}
+	}
+
+	void ParticleContactResolver::BuildLinks(const std::vector<ParticleContact>& contacts)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Links.clear();
+		m_Links.reserve(contacts.size() * 2);
+		for (uint32_t i = 0; i < contacts.size(); ++i)
+		{
+			for (uint32_t slot = 0; slot < 2; ++slot)
 			{
-				break;
+				if(contacts[i].particles[slot]) m_Links.push_back({contacts[i].particles[slot], i, slot});
 			}
+		}
 
-			contacts[maxIndex].Resolve(ts);
-			++iterationsUsed;
+		std::sort(m_Links.begin(), m_Links.end(), [](const ParticleLink& a, const ParticleLink& b) {
+			if(a.particle != b.particle) return std::less<Particle*>{}(a.particle, b.particle);
+			return a.contact < b.contact;
+		});
+
+		m_LinkRanges.assign(contacts.size(), {std::pair<uint32_t, uint32_t>{0, 0}, std::pair<uint32_t, uint32_t>{0, 0}});
+		uint32_t begin = 0;
+		while (begin < m_Links.size())
+		{
+			uint32_t end = begin + 1;
+			while (end < m_Links.size() && m_Links[end].particle == m_Links[begin].particle) ++end;
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				m_LinkRanges[m_Links[i].contact][m_Links[i].slot] = {begin, end};
+			}
+			begin = end;
+		}
+	}
+
+	void ParticleContactResolver::BuildHeap(const std::vector<ParticleContact>& contacts)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Heap.clear();
+		m_Heap.reserve(contacts.size());
+		m_HeapPositions.assign(contacts.size(), NotInHeap);
+		m_Priorities.resize(contacts.size());
+
+		for (uint32_t i = 0; i < contacts.size(); ++i)
+		{
+			m_Priorities[i] = GetPriority(contacts[i]);
+			if(m_Priorities[i] == REAL_MAX) continue;
+			m_HeapPositions[i] = static_cast<uint32_t>(m_Heap.size());
+			m_Heap.push_back(i);
+		}
+
+		// Floyd's heap construction.
+		for (uint32_t i = static_cast<uint32_t>(m_Heap.size() / 2); i-- > 0;)
+		{
+			SiftDown(i);
+		}
+	}
+
+	void ParticleContactResolver::UpdateContact(const std::vector<ParticleContact>& contacts, uint32_t contact)
+	{
+		Real priority = GetPriority(contacts[contact]);
+		Real previous = m_Priorities[contact];
+		m_Priorities[contact] = priority;
+
+		if(m_HeapPositions[contact] == NotInHeap)
+		{
+			if(priority != REAL_MAX) HeapPush(contact);
+			return;
+		}
+
+		if(priority == REAL_MAX)
+		{
+			HeapRemove(contact);
+		}
+		else if(priority < previous)
+		{
+			SiftUp(m_HeapPositions[contact]);
+		}
+		else
+		{
+			SiftDown(m_HeapPositions[contact]);
+		}
+	}
+
+	void ParticleContactResolver::HeapPush(uint32_t contact)
+	{
+		m_HeapPositions[contact] = static_cast<uint32_t>(m_Heap.size());
+		m_Heap.push_back(contact);
+		SiftUp(m_HeapPositions[contact]);
+	}
+
+	void ParticleContactResolver::HeapRemove(uint32_t contact)
+	{
+		uint32_t position = m_HeapPositions[contact];
+		uint32_t last = static_cast<uint32_t>(m_Heap.size() - 1);
+		if(position != last)
+		{
+			HeapSwap(position, last);
+		}
+		m_Heap.pop_back();
+		m_HeapPositions[contact] = NotInHeap;
+
+		if(position < m_Heap.size())
+		{
+			uint32_t moved = m_Heap[position];
+			SiftUp(position);
+			SiftDown(m_HeapPositions[moved]);
+		}
+	}
+
+	void ParticleContactResolver::SiftUp(uint32_t position)
+	{
+		while (position > 0)
+		{
+			uint32_t parent = (position - 1) / 2;
+			if(m_Priorities[m_Heap[parent]] <= m_Priorities[m_Heap[position]]) break;
+			HeapSwap(parent, position);
+			position = parent;
+		}
+	}
+
+	void ParticleContactResolver::SiftDown(uint32_t position)
+	{
+		const uint32_t size = static_cast<uint32_t>(m_Heap.size());
+		while (true)
+		{
+			uint32_t smallest = position;
+			uint32_t left = position * 2 + 1;
+			uint32_t right = left + 1;
+			if(left < size && m_Priorities[m_Heap[left]] < m_Priorities[m_Heap[smallest]]) smallest = left;
+			if(right < size && m_Priorities[m_Heap[right]] < m_Priorities[m_Heap[smallest]]) smallest = right;
+			if(smallest == position) break;
+			HeapSwap(smallest, position);
+			position = smallest;
+		}
+	}
+
+	void ParticleContactResolver::HeapSwap(uint32_t a, uint32_t b)
+	{
+		std::swap(m_Heap[a], m_Heap[b]);
+		m_HeapPositions[m_Heap[a]] = a;
+		m_HeapPositions[m_Heap[b]] = b;
+	}
+
+	Real ParticleContactResolver::GetPriority(const ParticleContact& contact)
+	{
+		Real totalInverseMass = contact.particles[0]->GetInverseMass();
+		if(contact.particles[1]) totalInverseMass += contact.particles[1]->GetInverseMass();
+
+		// Infinite mass, the contact cannot be resolved.
+		if(totalInverseMass <= 0) return REAL_MAX;
+
+		Real sepVel = contact.CalculateSeparatingVelocity();
+		if(sepVel < 0 || contact.penetration > 0)
+		{
+			return sepVel;
 		}
+		return REAL_MAX;
 	}
 
 	void ParticleContactResolver::SetIterations(uint32_t iterations)
 	{
 		this->iterations = iterations;
 	}
-}// namespace Voxymore::Core
\ No newline at end of file
+}// namespace Voxymore::Core
@@ -6,8 +6,6 @@
 #include "Voxymore/Components/Components.hpp"
 #include "Voxymore/ImGui/ImGuiLib.hpp"
 
-#define DeserializeField(node, fieldVariable, fieldName, type, defaultValue) fieldVariable = node[fieldName].as<type>(defaultValue);
-
 namespace Voxymore::Core
 {
 	ParticleComponent::ParticleComponent() : Particle()
@@ -21,21 +19,22 @@ namespace Voxymore::Core
 	{
 		VXM_PROFILE_FUNCTION();
 
-		DeserializeField(node, m_Position, "Position", Vec3, Vec3(0.0));
-		DeserializeField(node, m_Velocity, "Velocity", Vec3, Vec3(0.0));
-		DeserializeField(node, m_Acceleration, "Acceleration", Vec3, Vec3(0.0));
-		DeserializeField(node, m_Damping, "Damping", Real, 0.9);
-		DeserializeField(node, m_InverseMass, "InverseMass", Real, 1.0);
+		// Through the accessors, the state might already live in the batch of the physics layer.
+		SetPosition(node["Position"].as<Vec3>(Vec3(0.0)));
+		SetVelocity(node["Velocity"].as<Vec3>(Vec3(0.0)));
+		SetAcceleration(node["Acceleration"].as<Vec3>(Vec3(0.0)));
+		SetDamping(node["Damping"].as<Real>(0.9));
+		SetInverseMass(node["InverseMass"].as<Real>(1.0));
 	}
 
 	void ParticleComponent::SerializeComponent(YAML::Emitter& out)
 	{
 		VXM_PROFILE_FUNCTION();
-		out << KEYVAL("Position", m_Position);
-		out << KEYVAL("Acceleration", m_Acceleration);
-		out << KEYVAL("Velocity", m_Velocity);
-		out << KEYVAL("Damping", m_Damping);
-		out << KEYVAL("InverseMass", m_InverseMass);
+		out << KEYVAL("Position", GetPosition());
+		out << KEYVAL("Acceleration", GetAcceleration());
+		out << KEYVAL("Velocity", GetVelocity());
+		out << KEYVAL("Damping", GetDamping());
+		out << KEYVAL("InverseMass", GetInverseMass());
 	}
 
 	bool ParticleComponent::OnImGuiRender()
@@ -43,24 +42,32 @@ namespace Voxymore::Core
 		VXM_PROFILE_FUNCTION();
 		bool changed = false;
 
+		Vec3 velocity = GetVelocity();
+		Vec3 acceleration = GetAcceleration();
+		Real damping = GetDamping();
+		const Real inverseMass = GetInverseMass();
+
 		auto region = ImGui::GetContentRegionAvail();
-		changed |= ImGuiLib::DrawVec3Control("Velocity", m_Velocity);
+		changed |= ImGuiLib::DrawVec3Control("Velocity", velocity);
 		ImVec2 min = ImGui::GetItemRectMin();
 		ImVec2 max = ImGui::GetItemRectMax();
 		max.x += region.x;
 		auto mouse = ImGui::GetMousePos();
 		if (ImGui::IsMouseHoveringRect(min, max))
 		{
-			ImGui::SetTooltip("Speed : %f m/s", Math::Magnitude(m_Velocity));
+			ImGui::SetTooltip("Speed : %f m/s", Math::Magnitude(velocity));
 		}
 
-		changed |= ImGuiLib::DrawVec3Control("Acceleration", m_Acceleration);
-		changed |= ImGuiLib::DragReal("Damping", &m_Damping, 0.001, 0, 1);
-		Real mass =  1.0 / m_InverseMass;
+		changed |= ImGuiLib::DrawVec3Control("Acceleration", acceleration);
+		changed |= ImGuiLib::DragReal("Damping", &damping, 0.001, 0, 1);
+		Real mass =  1.0 / inverseMass;
 		changed |= ImGuiLib::DragReal("Mass", &mass, 0.01, 0.01);
-		if(changed && mass > 0)
+		if(changed)
 		{
-			m_InverseMass = 1.0 / mass;
+			SetVelocity(velocity);
+			SetAcceleration(acceleration);
+			SetDamping(damping);
+			if(mass > 0) SetInverseMass(1.0 / mass);
 		}
 		return changed;
 	}
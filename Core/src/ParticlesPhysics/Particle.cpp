@@ -3,6 +3,7 @@
 //
 
 #include "Voxymore/ParticlesPhysics/Particle.hpp"
+#include "Voxymore/ParticlesPhysics/ParticleBatch.hpp"
 
 namespace Voxymore::Core
 {
@@ -16,72 +17,130 @@ namespace Voxymore::Core
 	{
 	}
 
-	const Vec3& Particle::GetPosition() const
+	Particle::Particle(const Particle& other) :
+			m_Position(other.GetPosition()), m_Velocity(other.GetVelocity()), m_Acceleration(other.GetAcceleration()), m_Damping(other.GetDamping()), m_InverseMass(other.GetInverseMass()), m_ForceAccumulate(other.GetForceAccumulate())
+	{
+	}
+
+	Particle::Particle(Particle&& other) noexcept :
+			m_Position(other.m_Position), m_Velocity(other.m_Velocity), m_Acceleration(other.m_Acceleration), m_Damping(other.m_Damping), m_InverseMass(other.m_InverseMass), m_ForceAccumulate(other.m_ForceAccumulate),
+			m_Batch(other.m_Batch), m_BatchIndex(other.m_BatchIndex)
+	{
+		other.m_Batch = nullptr;
+	}
+
+	Particle& Particle::operator=(const Particle& other)
+	{
+		if(this == &other) return *this;
+		CopyState(other);
+		return *this;
+	}
+
+	Particle& Particle::operator=(Particle&& other) noexcept
+	{
+		if(this == &other) return *this;
+		if(!m_Batch && other.m_Batch)
+		{
+			// The registry relocating a component, the binding follows it.
+			m_Position = other.m_Position;
+			m_Velocity = other.m_Velocity;
+			m_Acceleration = other.m_Acceleration;
+			m_Damping = other.m_Damping;
+			m_InverseMass = other.m_InverseMass;
+			m_ForceAccumulate = other.m_ForceAccumulate;
+			m_Batch = other.m_Batch;
+			m_BatchIndex = other.m_BatchIndex;
+			other.m_Batch = nullptr;
+		}
+		else
+		{
+			CopyState(other);
+		}
+		return *this;
+	}
+
+	void Particle::CopyState(const Particle& other)
+	{
+		SetPosition(other.GetPosition());
+		SetVelocity(other.GetVelocity());
+		SetAcceleration(other.GetAcceleration());
+		SetDamping(other.GetDamping());
+		SetInverseMass(other.GetInverseMass());
+		ClearAccumulator();
+		AccumulateForce(other.GetForceAccumulate());
+	}
+
+	Vec3 Particle::GetPosition() const
 	{
 		VXM_PROFILE_FUNCTION();
-		return m_Position;
+		return m_Batch ? m_Batch->GetPosition(m_BatchIndex) : m_Position;
 	}
 
 	void Particle::SetPosition(const Vec3& position)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_Position = position;
+		if(m_Batch) m_Batch->SetPosition(m_BatchIndex, position);
+		else m_Position = position;
 	}
 
 	void Particle::AddMovement(const Vec3& movement)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_Position += movement;
+		SetPosition(GetPosition() + movement);
 	}
 
-	const Vec3& Particle::GetVelocity() const
+	Vec3 Particle::GetVelocity() const
 	{
 		VXM_PROFILE_FUNCTION();
-		return m_Velocity;
+		return m_Batch ? m_Batch->GetVelocity(m_BatchIndex) : m_Velocity;
 	}
 
 	void Particle::SetVelocity(const Vec3& velocity)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_Velocity = velocity;
+		if(m_Batch) m_Batch->SetVelocity(m_BatchIndex, velocity);
+		else m_Velocity = velocity;
 	}
 
 	void Particle::AddVelocity(const Vec3& velocity)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_Velocity += velocity;
+		SetVelocity(GetVelocity() + velocity);
 	}
 
-	const Vec3& Particle::GetAcceleration() const
+	Vec3 Particle::GetAcceleration() const
 	{
 		VXM_PROFILE_FUNCTION();
-		return m_Acceleration;
+		return m_Batch ? m_Batch->GetAcceleration(m_BatchIndex) : m_Acceleration;
 	}
 
 	void Particle::SetAcceleration(const Vec3& acceleration)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_Acceleration = acceleration;
+		if(m_Batch) m_Batch->SetAcceleration(m_BatchIndex, acceleration);
+		else m_Acceleration = acceleration;
 	}
 
 	Real Particle::GetDamping() const
 	{
 		VXM_PROFILE_FUNCTION();
-		return m_Damping;
+		return m_Batch ? m_Batch->GetDamping(m_BatchIndex) : m_Damping;
 	}
 
 	void Particle::SetDamping(const Real& damping)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_Damping = damping;
+		if(m_Batch) m_Batch->SetDamping(m_BatchIndex, damping);
+		else m_Damping = damping;
 	}
 
 	Real Particle::GetMass() const
 	{
 		VXM_PROFILE_FUNCTION();
-		VXM_CORE_ASSERT(m_InverseMass != 0, "The mass cannot be 0.");
-		if (m_InverseMass != 0) {
-			return ((Real)1.0) / m_InverseMass;
+		const Real inverseMass = GetInverseMass();
+		VXM_CORE_ASSERT(inverseMass != 0, "The mass cannot be 0.");
+		if (inverseMass != 0) {
+			return ((Real)1.0) / inverseMass;
 		}
 		else {
 			return 0.0;
@@ -91,7 +150,13 @@ namespace Voxymore::Core
 	Real Particle::GetInverseMass() const
 	{
 		VXM_PROFILE_FUNCTION();
-		return m_InverseMass;
+		return m_Batch ? m_Batch->GetInverseMass(m_BatchIndex) : m_InverseMass;
+	}
+
+	Vec3 Particle::GetForceAccumulate() const
+	{
+		VXM_PROFILE_FUNCTION();
+		return m_Batch ? m_Batch->GetForce(m_BatchIndex) : m_ForceAccumulate;
 	}
 
 	void Particle::SetMass(const Real& mass)
@@ -99,44 +164,54 @@ namespace Voxymore::Core
 		VXM_PROFILE_FUNCTION();
 		VXM_CORE_ASSERT(mass != 0, "The mass cannot be 0.");
 		if(mass == 0){
-			m_InverseMass = 0;
+			SetInverseMass(0);
 		}
 		else {
-			m_InverseMass = 1.0 / mass;
+			SetInverseMass(1.0 / mass);
 		}
 	}
 
 	void Particle::SetInverseMass(const Real& inverseMass)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_InverseMass = inverseMass;
+		if(m_Batch) m_Batch->SetInverseMass(m_BatchIndex, inverseMass);
+		else m_InverseMass = inverseMass;
 	}
 
 	void Particle::Integrate(Real ts)
 	{
 		VXM_PROFILE_FUNCTION();
 
-		if(m_InverseMass <= 0) {
-			VXM_CORE_WARNING("The inverse mass of {0} is not valid, not integrating.", m_InverseMass);
+		const Real inverseMass = GetInverseMass();
+		if(inverseMass <= 0) {
+			VXM_CORE_WARNING("The inverse mass of {0} is not valid, not integrating.", inverseMass);
 			return;
 		}
 
 		VXM_CORE_ASSERT(ts != 0, "The timestep is supposed to be different from 0.");
 
+		Vec3 position = GetPosition();
+		Vec3 velocity = GetVelocity();
+		const Vec3 acceleration = GetAcceleration();
+
 		// Update position from velocity (and acceleration)
-		m_Position += m_Velocity * ts;
-		m_Position += m_Acceleration * ((ts * ts) * ((Real)0.5));
+		position += velocity * ts;
+		position += acceleration * ((ts * ts) * ((Real)0.5));
 
 		// Update the acceleartion later on so pre-creating a variable.
-		Vec3 acc = m_Acceleration;
-		acc += m_ForceAccumulate * m_InverseMass;
+		Vec3 acc = acceleration;
+		acc += GetForceAccumulate() * inverseMass;
 
 		// Update linear velocity from acceleration
-		m_Velocity += acc * ts;
+		velocity += acc * ts;
 
 		// Damping the velocity.
-		VXM_CORE_CHECK(m_Damping <= 1, "The Damping has the value {0}.", m_Damping);
-		m_Velocity *= Math::Pow(m_Damping, ts);
+		const Real damping = GetDamping();
+		VXM_CORE_CHECK(damping <= 1, "The Damping has the value {0}.", damping);
+		velocity *= Math::Pow(damping, ts);
+
+		SetPosition(position);
+		SetVelocity(velocity);
 
 		// Clear the forces
 		ClearAccumulator();
@@ -146,18 +221,20 @@ namespace Voxymore::Core
 	{
 		VXM_PROFILE_FUNCTION();
 		Vec3 force = acceleration * GetMass();
-		m_ForceAccumulate += force;
+		AccumulateForce(force);
 	}
 
 	void Particle::AccumulateForce(Vec3 force)
 	{
 		VXM_PROFILE_FUNCTION();
-		m_ForceAccumulate += force;
+		if(m_Batch) m_Batch->AddForce(m_BatchIndex, force);
+		else m_ForceAccumulate += force;
 	}
 
 	void Particle::ClearAccumulator()
 	{
 		VXM_PROFILE_FUNCTION();
-		m_ForceAccumulate = Vec3(0);
+		if(m_Batch) m_Batch->SetForce(m_BatchIndex, Vec3(0));
+		else m_ForceAccumulate = Vec3(0);
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,232 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/ParticlesPhysics/ParticleBatch.hpp"
+#include <algorithm>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define VXM_PARTICLE_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define VXM_PARTICLE_SSE
+#endif
+
+namespace Voxymore::Core
+{
+	namespace
+	{
+#if defined(VXM_PARTICLE_AVX) && defined(VXM_DOUBLE)
+		using SimdReal = __m256d;
+		constexpr size_t SimdWidth = 4;
+		inline SimdReal SimdLoad(const Real* p) { return _mm256_loadu_pd(p); }
+		inline void SimdStore(Real* p, SimdReal v) { _mm256_storeu_pd(p, v); }
+		inline SimdReal SimdSet(Real v) { return _mm256_set1_pd(v); }
+		inline SimdReal SimdAdd(SimdReal a, SimdReal b) { return _mm256_add_pd(a, b); }
+		inline SimdReal SimdMul(SimdReal a, SimdReal b) { return _mm256_mul_pd(a, b); }
+#elif defined(VXM_PARTICLE_AVX)
+		using SimdReal = __m256;
+		constexpr size_t SimdWidth = 8;
+		inline SimdReal SimdLoad(const Real* p) { return _mm256_loadu_ps(p); }
+		inline void SimdStore(Real* p, SimdReal v) { _mm256_storeu_ps(p, v); }
+		inline SimdReal SimdSet(Real v) { return _mm256_set1_ps(v); }
+		inline SimdReal SimdAdd(SimdReal a, SimdReal b) { return _mm256_add_ps(a, b); }
+		inline SimdReal SimdMul(SimdReal a, SimdReal b) { return _mm256_mul_ps(a, b); }
+#elif defined(VXM_PARTICLE_SSE) && defined(VXM_DOUBLE)
+		using SimdReal = __m128d;
+		constexpr size_t SimdWidth = 2;
+		inline SimdReal SimdLoad(const Real* p) { return _mm_loadu_pd(p); }
+		inline void SimdStore(Real* p, SimdReal v) { _mm_storeu_pd(p, v); }
+		inline SimdReal SimdSet(Real v) { return _mm_set1_pd(v); }
+		inline SimdReal SimdAdd(SimdReal a, SimdReal b) { return _mm_add_pd(a, b); }
+		inline SimdReal SimdMul(SimdReal a, SimdReal b) { return _mm_mul_pd(a, b); }
+#elif defined(VXM_PARTICLE_SSE)
+		using SimdReal = __m128;
+		constexpr size_t SimdWidth = 4;
+		inline SimdReal SimdLoad(const Real* p) { return _mm_loadu_ps(p); }
+		inline void SimdStore(Real* p, SimdReal v) { _mm_storeu_ps(p, v); }
+		inline SimdReal SimdSet(Real v) { return _mm_set1_ps(v); }
+		inline SimdReal SimdAdd(SimdReal a, SimdReal b) { return _mm_add_ps(a, b); }
+		inline SimdReal SimdMul(SimdReal a, SimdReal b) { return _mm_mul_ps(a, b); }
+#endif
+	}
+
+	void ParticleBatch::SoAVec3::push_back(const Vec3& value)
+	{
+		x.push_back(value.x);
+		y.push_back(value.y);
+		z.push_back(value.z);
+	}
+
+	void ParticleBatch::SoAVec3::reserve(size_t count)
+	{
+		x.reserve(count);
+		y.reserve(count);
+		z.reserve(count);
+	}
+
+	void ParticleBatch::SoAVec3::clear()
+	{
+		x.clear();
+		y.clear();
+		z.clear();
+	}
+
+	void ParticleBatch::SoAVec3::swap_remove(uint32_t index)
+	{
+		x[index] = x.back();
+		y[index] = y.back();
+		z[index] = z.back();
+		x.pop_back();
+		y.pop_back();
+		z.pop_back();
+	}
+
+	void ParticleBatch::SoAVec3::fill(Real value)
+	{
+		std::fill(x.begin(), x.end(), value);
+		std::fill(y.begin(), y.end(), value);
+		std::fill(z.begin(), z.end(), value);
+	}
+
+	uint32_t ParticleBatch::Add(entt::entity entity, Particle& particle)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(!particle.IsBound(), "The particle is already bound to a batch.");
+		VXM_CORE_ASSERT(!Contains(entity), "The entity {0} already has a particle in the batch.", entt::to_integral(entity));
+		uint32_t index = static_cast<uint32_t>(size());
+		m_Position.push_back(particle.m_Position);
+		m_Velocity.push_back(particle.m_Velocity);
+		m_Acceleration.push_back(particle.m_Acceleration);
+		m_Force.push_back(particle.m_ForceAccumulate);
+		m_Damping.push_back(particle.m_Damping);
+		m_InverseMass.push_back(particle.m_InverseMass);
+		m_Entities.push_back(entity);
+		m_Indices[entity] = index;
+
+		particle.m_Batch = this;
+		particle.m_BatchIndex = index;
+		return index;
+	}
+
+	entt::entity ParticleBatch::Remove(Particle& particle)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(particle.m_Batch == this, "The particle is not bound to this batch.");
+		const uint32_t index = particle.m_BatchIndex;
+
+		particle.m_Position = m_Position.Get(index);
+		particle.m_Velocity = m_Velocity.Get(index);
+		particle.m_Acceleration = m_Acceleration.Get(index);
+		particle.m_ForceAccumulate = m_Force.Get(index);
+		particle.m_Damping = m_Damping[index];
+		particle.m_InverseMass = m_InverseMass[index];
+		particle.m_Batch = nullptr;
+
+		m_Indices.erase(m_Entities[index]);
+		const uint32_t last = static_cast<uint32_t>(size() - 1);
+		m_Position.swap_remove(index);
+		m_Velocity.swap_remove(index);
+		m_Acceleration.swap_remove(index);
+		m_Force.swap_remove(index);
+		m_Damping[index] = m_Damping.back();
+		m_Damping.pop_back();
+		m_InverseMass[index] = m_InverseMass.back();
+		m_InverseMass.pop_back();
+		m_Entities[index] = m_Entities.back();
+		m_Entities.pop_back();
+
+		if(index == last) return entt::null;
+		m_Indices[m_Entities[index]] = index;
+		return m_Entities[index];
+	}
+
+	void ParticleBatch::Rebind(entt::entity entity, Particle& particle) const
+	{
+		auto it = m_Indices.find(entity);
+		VXM_CORE_ASSERT(it != m_Indices.end(), "The entity {0} has no particle in the batch.", entt::to_integral(entity));
+		if(it == m_Indices.end()) return;
+		particle.m_BatchIndex = it->second;
+	}
+
+	bool ParticleBatch::Contains(entt::entity entity) const
+	{
+		return m_Indices.contains(entity);
+	}
+
+	void ParticleBatch::Integrate(Real ts)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(ts != 0, "The timestep is supposed to be different from 0.");
+		const size_t count = size();
+		if(count == 0) return;
+
+		m_DampingFactor.resize(count);
+		m_TimeStep.resize(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			VXM_CORE_CHECK(m_Damping[i] <= 1, "The Damping has the value {0}.", m_Damping[i]);
+			m_TimeStep[i] = m_InverseMass[i] > 0 ? ts : 0;
+			m_DampingFactor[i] = Math::Pow(m_Damping[i], m_TimeStep[i]);
+		}
+
+		IntegrateComponent(count, m_Position.x.data(), m_Velocity.x.data(), m_Acceleration.x.data(), m_Force.x.data(), m_InverseMass.data(), m_DampingFactor.data(), m_TimeStep.data());
+		IntegrateComponent(count, m_Position.y.data(), m_Velocity.y.data(), m_Acceleration.y.data(), m_Force.y.data(), m_InverseMass.data(), m_DampingFactor.data(), m_TimeStep.data());
+		IntegrateComponent(count, m_Position.z.data(), m_Velocity.z.data(), m_Acceleration.z.data(), m_Force.z.data(), m_InverseMass.data(), m_DampingFactor.data(), m_TimeStep.data());
+	}
+
+	void ParticleBatch::IntegrateComponent(size_t count, Real* position, Real* velocity, const Real* acceleration, const Real* force, const Real* inverseMass, const Real* damping, const Real* timeStep)
+	{
+		VXM_PROFILE_FUNCTION();
+		size_t i = 0;
+
+#if defined(VXM_PARTICLE_AVX) || defined(VXM_PARTICLE_SSE)
+		const SimdReal vHalf = SimdSet((Real)0.5);
+		for (; i + SimdWidth <= count; i += SimdWidth)
+		{
+			SimdReal p = SimdLoad(position + i);
+			SimdReal v = SimdLoad(velocity + i);
+			SimdReal a = SimdLoad(acceleration + i);
+			SimdReal ts = SimdLoad(timeStep + i);
+
+			// p += v * ts + a * ts^2 / 2
+			p = SimdAdd(p, SimdMul(ts, SimdAdd(v, SimdMul(a, SimdMul(ts, vHalf)))));
+
+			// v = (v + (a + f * inverseMass) * ts) * damping^ts
+			a = SimdAdd(a, SimdMul(SimdLoad(force + i), SimdLoad(inverseMass + i)));
+			v = SimdMul(SimdAdd(v, SimdMul(a, ts)), SimdLoad(damping + i));
+
+			SimdStore(position + i, p);
+			SimdStore(velocity + i, v);
+		}
+#endif
+
+		// Remaining particles, or all of them when no SIMD instruction set is available.
+		for (; i < count; ++i)
+		{
+			const Real ts = timeStep[i];
+			position[i] += velocity[i] * ts + acceleration[i] * (ts * ts * (Real)0.5);
+			Real a = acceleration[i] + force[i] * inverseMass[i];
+			velocity[i] = (velocity[i] + a * ts) * damping[i];
+		}
+	}
+
+	void ParticleBatch::ClearForces()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Force.fill(0);
+	}
+
+	void ParticleBatch::Reserve(size_t count)
+	{
+		m_Position.reserve(count);
+		m_Velocity.reserve(count);
+		m_Acceleration.reserve(count);
+		m_Force.reserve(count);
+		m_Damping.reserve(count);
+		m_InverseMass.reserve(count);
+		m_Entities.reserve(count);
+		m_Indices.reserve(count);
+	}
+} // namespace Voxymore::Core
@@ -2,8 +2,10 @@
 // Created by ianpo on 05/01/2024.
 //
 
+#include <chrono>
 #include <utility>
 
+#include "Voxymore/Core/MultiThreading.hpp"
 #include "Voxymore/Components/Components.hpp"
 #include "Voxymore/ParticlesPhysics/ParticlePhysicsLayer.hpp"
 #include "Voxymore/ParticlesPhysics/Components/ParticleComponent.hpp"
@@ -19,6 +21,7 @@ namespace Voxymore::Core
 
 	ParticlePhysicsLayer::~ParticlePhysicsLayer()
 	{
+		if(HasScene()) DisconnectScene();
 	}
 
 	void ParticlePhysicsLayer::OnAttach()
@@ -53,35 +56,201 @@ namespace Voxymore::Core
 			return;
 		}
 
-		// Integrate all Particles
-		auto func = [&ts](entt::entity e, ParticleComponent& pc, TransformComponent& tc){
-			VXM_PROFILE_FUNCTION();
-			pc.SetPosition(tc.GetPosition());
-			pc.Integrate(ts);
-			tc.SetPosition(pc.GetPosition());
-		};
+		const uint32_t steps = m_FixedTimeStep.Advance(ts);
+		if(m_Interpolate) RestoreTransforms();
 
-		m_SceneHandle->each<ParticleComponent, TransformComponent>(exclude<DisableComponent>, func);
+		if(steps > 0) SimulateSteps(steps);
+		// The forces are accumulated again by the systems each frame.
+		m_Batch.ClearForces();
 
-		if(!m_Contacts.empty())
+		if(m_Interpolate) InterpolateTransforms(m_FixedTimeStep.GetAlpha());
+	}
+
+	void ParticlePhysicsLayer::Simulate(uint32_t stepCount)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(!HasScene() || stepCount == 0) return;
+
+		if(m_Interpolate) RestoreTransforms();
+		SimulateSteps(stepCount);
+		m_Batch.ClearForces();
+		if(m_Interpolate) InterpolateTransforms(1);
+	}
+
+	void ParticlePhysicsLayer::SimulateSteps(uint32_t stepCount)
+	{
+		VXM_PROFILE_FUNCTION();
+		const TimeStep dt = m_FixedTimeStep.GetFixedDeltaTime();
+		using Clock = std::chrono::steady_clock;
+
+		// The particles are integrated in place in the batch, the forces accumulated this frame being applied on each step.
+		// The contacts are found and resolved after each step so the particles never move through each other between two resolutions.
+		GatherTransforms();
+		for (uint32_t i = 0; i < stepCount; ++i)
+		{
+			const auto begin = Clock::now();
+			if(m_Interpolate && i + 1 == stepCount)
+			{
+				for (uint32_t index = 0; index < m_Transforms.size(); ++index)
+				{
+					if(m_Transforms[index]) m_Snapshots.SavePrevious(m_Batch.GetEntity(index), m_Batch.GetPosition(index), m_Transforms[index]->GetRotation());
+				}
+			}
+			m_Batch.Integrate(dt);
+			const auto integrated = Clock::now();
+
+			m_StepContacts.clear();
+			// The contacts given by the caller were found on the state of the frame, they are only valid for its first step.
+			if(i == 0) m_StepContacts.swap(m_Contacts);
+			for (const Ref<ParticleContactGenerator>& generator : m_ContactGenerators)
+			{
+				generator->AddContacts(m_StepContacts);
+			}
+
+			m_Stats.contacts += m_StepContacts.size();
+			if(!m_StepContacts.empty())
+			{
+				m_Resolver.SetIterations(m_StepContacts.size() * 2);
+				m_Resolver.ResolveContacts(dt, m_StepContacts);
+			}
+
+			m_Stats.integrate += std::chrono::duration<double>(integrated - begin).count();
+			m_Stats.resolve += std::chrono::duration<double>(Clock::now() - integrated).count();
+		}
+		m_Contacts.clear();
+
+		SyncTransforms();
+
+		m_Stats.steps += stepCount;
+	}
+
+	void ParticlePhysicsLayer::GatherTransforms()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Transforms.assign(m_Batch.size(), nullptr);
+		auto view = m_SceneHandle->view<ParticleComponent, TransformComponent>(exclude<DisableComponent>);
+		for (auto e : view)
+		{
+			const ParticleComponent& pc = view.get<ParticleComponent>(e);
+			if(!pc.IsBound()) continue;
+			TransformComponent& tc = view.get<TransformComponent>(e);
+			m_Transforms[pc.GetBatchIndex()] = &tc;
+			m_Batch.SetPosition(pc.GetBatchIndex(), tc.GetPosition());
+		}
+	}
+
+	void ParticlePhysicsLayer::SyncTransforms()
+	{
+		VXM_PROFILE_FUNCTION();
+		for (uint32_t index = 0; index < m_Transforms.size(); ++index)
+		{
+			TransformComponent* tc = m_Transforms[index];
+			if(!tc) continue;
+			tc->SetPosition(m_Batch.GetPosition(index));
+			if(m_Interpolate) m_Snapshots.SaveCurrent(m_Batch.GetEntity(index), *tc);
+		}
+	}
+
+	void ParticlePhysicsLayer::RestoreTransforms()
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<ParticleComponent, TransformComponent>(exclude<DisableComponent>);
+		for (auto e : view)
+		{
+			m_Snapshots.Restore(e, view.get<TransformComponent>(e));
+		}
+	}
+
+	void ParticlePhysicsLayer::InterpolateTransforms(Real alpha)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<ParticleComponent, TransformComponent>(exclude<DisableComponent>);
+		for (auto e : view)
 		{
-			VXM_CORE_INFO("Resolve {0} contacts with maximum {1} iterations.",m_Contacts.size() , m_Contacts.size() * 2);
-			m_Resolver.SetIterations(m_Contacts.size() * 2);
-			m_Resolver.ResolveContacts(ts, m_Contacts);
-			m_Contacts.clear();
+			m_Snapshots.Interpolate(e, view.get<TransformComponent>(e), alpha);
 		}
 	}
 
 	void ParticlePhysicsLayer::SetScene(Ref<Scene> scene)
 	{
 		VXM_PROFILE_FUNCTION();
+		if(HasScene()) DisconnectScene();
 		m_SceneHandle = std::move(scene);
+		m_FixedTimeStep.Reset();
+		m_Snapshots.Clear();
+		if(HasScene()) ConnectScene();
 	}
 
 	void ParticlePhysicsLayer::ResetScene()
 	{
 		VXM_PROFILE_FUNCTION();
+		if(HasScene()) DisconnectScene();
 		m_SceneHandle = nullptr;
+		m_Snapshots.Clear();
+	}
+
+	void ParticlePhysicsLayer::ConnectScene()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_SceneHandle->on_construct<ParticleComponent>().connect<&ParticlePhysicsLayer::OnAddParticle>(this);
+		m_SceneHandle->on_destroy<ParticleComponent>().connect<&ParticlePhysicsLayer::OnRemoveParticle>(this);
+		m_SceneHandle->on_construct<DisableComponent>().connect<&ParticlePhysicsLayer::OnRemoveParticle>(this);
+		m_SceneHandle->on_destroy<DisableComponent>().connect<&ParticlePhysicsLayer::OnEnableEntity>(this);
+
+		auto view = m_SceneHandle->view<ParticleComponent>(exclude<DisableComponent>);
+		m_Batch.Reserve(view.size_hint());
+		for (auto e : view)
+		{
+			m_Batch.Add(e, view.get<ParticleComponent>(e));
+		}
+	}
+
+	void ParticlePhysicsLayer::DisconnectScene()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_SceneHandle->on_construct<ParticleComponent>().disconnect<&ParticlePhysicsLayer::OnAddParticle>(this);
+		m_SceneHandle->on_destroy<ParticleComponent>().disconnect<&ParticlePhysicsLayer::OnRemoveParticle>(this);
+		m_SceneHandle->on_construct<DisableComponent>().disconnect<&ParticlePhysicsLayer::OnRemoveParticle>(this);
+		m_SceneHandle->on_destroy<DisableComponent>().disconnect<&ParticlePhysicsLayer::OnEnableEntity>(this);
+
+		// The components get their state back, the batch is empty once they are all removed.
+		while(!m_Batch.empty())
+		{
+			OnRemoveParticle(m_Batch.GetEntity(static_cast<uint32_t>(m_Batch.size() - 1)));
+		}
+		m_Transforms.clear();
+	}
+
+	void ParticlePhysicsLayer::OnAddParticle(entt::entity e)
+	{
+		VXM_PROFILE_FUNCTION();
+		Entity entity(e, m_SceneHandle.get());
+		if(entity.HasComponent<DisableComponent>()) return;
+		ParticleComponent& pc = entity.GetComponent<ParticleComponent>();
+		if(!pc.IsBound()) m_Batch.Add(e, pc);
+	}
+
+	void ParticlePhysicsLayer::OnRemoveParticle(entt::entity e)
+	{
+		VXM_PROFILE_FUNCTION();
+		Entity entity(e, m_SceneHandle.get());
+		if(!entity.HasComponent<ParticleComponent>()) return;
+		ParticleComponent& pc = entity.GetComponent<ParticleComponent>();
+		if(!pc.IsBound()) return;
+
+		m_Snapshots.Remove(e);
+		entt::entity moved = m_Batch.Remove(pc);
+		if(moved != entt::null) m_Batch.Rebind(moved, Entity(moved, m_SceneHandle.get()).GetComponent<ParticleComponent>());
+	}
+
+	void ParticlePhysicsLayer::OnEnableEntity(entt::entity e)
+	{
+		VXM_PROFILE_FUNCTION();
+		// Called before the DisableComponent is removed.
+		Entity entity(e, m_SceneHandle.get());
+		if(!entity.HasComponent<ParticleComponent>()) return;
+		ParticleComponent& pc = entity.GetComponent<ParticleComponent>();
+		if(!pc.IsBound()) m_Batch.Add(e, pc);
 	}
 
 	bool ParticlePhysicsLayer::HasScene() const
@@ -111,4 +280,17 @@ namespace Voxymore::Core
 		VXM_PROFILE_FUNCTION();
 		m_Contacts.insert(m_Contacts.end(), contacts.begin(), contacts.end());
 	}
+
+	void ParticlePhysicsLayer::AddContactGenerator(Ref<ParticleContactGenerator> generator)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(!generator) return;
+		m_ContactGenerators.push_back(std::move(generator));
+	}
+
+	void ParticlePhysicsLayer::RemoveContactGenerator(const Ref<ParticleContactGenerator>& generator)
+	{
+		VXM_PROFILE_FUNCTION();
+		std::erase(m_ContactGenerators, generator);
+	}
 } // namespace Voxymore::Core
@@ -12,29 +12,33 @@ namespace Voxymore::Core
 	void SpringForceSystem::Update(Scene& scene, TimeStep ts)
 	{
 		VXM_PROFILE_FUNCTION();
-		auto func = [&](auto entity, AnchoredSpringComponent& asc, TransformComponent& tc)
+		// One spring pulls on many particles, so the forces are recorded and applied once all the springs are computed.
+		auto func = [&](entt::entity entity, AnchoredSpringComponent& asc, TransformComponent& tc)
 		{
 			VXM_PROFILE_FUNCTION();
 			Vec3 anchorPos = tc.GetPosition();
-			auto current = Entity(entity, &scene);
-			for(auto& field : asc.EntitiesConnected)
+			for(uint32_t i = 0; i < asc.EntitiesConnected.size(); ++i)
 			{
-				auto e = field.GetEntity(scene);
+				auto e = asc.EntitiesConnected[i].GetEntity(scene);
 				if(!e.HasComponent<ParticleComponent>()) continue;
 
 				Vec3 posE = e.GetComponent<TransformComponent>().GetPosition();
 				Vec3 springForce = posE - anchorPos;
 				float magnitude = Math::Magnitude(springForce);
 				if(magnitude <= asc.RestLength) {
-					return;
+					continue;
 				}
 
 				float forceMagnitude = (asc.RestLength - magnitude) * asc.SpringConstant;
 
 				Vec3 force = Math::Normalize(springForce) * (forceMagnitude);
-				e.GetComponent<ParticleComponent>().AccumulateForce(force);
+				m_Forces.AddForce(entity, i, e, force);
 			}
 		};
-		scene.each<AnchoredSpringComponent, TransformComponent>(exclude<DisableComponent>, func);
+		scene.each<AnchoredSpringComponent, TransformComponent>(exclude<DisableComponent>, MultiThreading::ExecutionPolicy::Parallel, func);
+
+		m_Forces.Reduce([&scene](const ForceAccumulator::ForceRecord& record) {
+			Entity(record.target, &scene).GetComponent<ParticleComponent>().AccumulateForce(record.force);
+		});
 	}
 } // namespace Voxymore::Core
@@ -73,6 +73,8 @@ namespace Voxymore::Core
 		m_VertexArray->AddVertexBuffer(m_VertexBuffer);
 		m_VertexArray->SetIndexBuffer(m_IndexBuffer);
 
+		m_VertexCount = static_cast<uint32_t>(vertices.size());
+
 		if (!vertices.empty())
 		{
 			for (const auto& v : vertices) {
@@ -96,6 +98,8 @@ namespace Voxymore::Core
 		m_VertexArray->AddVertexBuffer(m_VertexBuffer);
 		m_VertexArray->SetIndexBuffer(m_IndexBuffer);
 
+		m_VertexCount = static_cast<uint32_t>(vertices.size());
+
 		if (!m_BoundingBox && !vertices.empty())
 		{
 			for (const auto& v : vertices) {
@@ -104,6 +108,21 @@ namespace Voxymore::Core
 		}
 	}
 
+	const std::vector<glm::vec3>& Mesh::GetPositions() const
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_Positions.empty() && m_VertexCount > 0)
+		{
+			std::vector<Vertex> vertices(m_VertexCount);
+			m_VertexBuffer->GetData(vertices.data(), m_VertexCount * sizeof(Vertex));
+			m_Positions.reserve(vertices.size());
+			for (const auto& v : vertices) {
+				m_Positions.push_back(v.Position);
+			}
+		}
+		return m_Positions;
+	}
+
 	void Mesh::Bind() const
 	{
 		VXM_PROFILE_FUNCTION();
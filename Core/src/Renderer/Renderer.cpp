@@ -5,11 +5,14 @@
 #include "Voxymore/Renderer/Renderer.hpp"
 #include "Voxymore/Core/Logger.hpp"
 #include "Voxymore/OpenGL/OpenGLShader.hpp"
+#include <algorithm>
 
 namespace Voxymore::Core {
 	static RendererData s_Data;
 	static ShaderField s_BindedShader = NullAssetHandle;
 	static MaterialField s_BindedMaterial = NullAssetHandle;
+	// Number of scenes after which a curve patch that wasn't drawn is released.
+	static constexpr uint64_t s_CurvePatchLifetime = 256;
 
 	RendererData::ModelData::ModelData(glm::mat4 transformMatrix, glm::mat4 normalMatrix, int entityId) : TransformMatrix(transformMatrix), NormalMatrix(normalMatrix), EntityId(entityId) {}
 
@@ -27,7 +30,8 @@ namespace Voxymore::Core {
 
 	void Renderer::Shutdown() {
 		VXM_PROFILE_FUNCTION();
-
+		s_Data.CurveMeshes.clear();
+		s_Data.SurfacePatch = nullptr;
 
 		RenderCommand::Shutdown();
 	}
@@ -51,6 +55,7 @@ namespace Voxymore::Core {
 
 		s_Data.AlphaMeshes.clear();
 		s_Data.OpaqueMeshes.clear();
+		ReleaseUnusedCurvePatches();
 	}
 
 	void Renderer::BeginScene(const Camera &camera, const glm::mat4 &transform, std::vector<Light> lights)
@@ -72,6 +77,7 @@ namespace Voxymore::Core {
 
 		s_Data.AlphaMeshes.clear();
 		s_Data.OpaqueMeshes.clear();
+		ReleaseUnusedCurvePatches();
 	}
 
 	void Renderer::DrawMesh(Ref<Mesh> m, const glm::mat4& modelMatrix, int entityId)
@@ -100,6 +106,78 @@ namespace Voxymore::Core {
 		RenderCommand::DrawIndexed(m->GetVertexArray());
 	}
 
+	const Ref<Mesh>& Renderer::GetCurvePatch(std::span<const float> knots)
+	{
+		VXM_PROFILE_FUNCTION();
+		uint64_t hash = knots.size();
+		for (float knot : knots) {
+			hash ^= std::hash<float>{}(knot) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+		}
+
+		RendererData::CurveMesh& curveMesh = s_Data.CurveMeshes[hash];
+		curveMesh.LastUsedFrame = s_Data.FrameIndex;
+		if (curveMesh.Patch && std::equal(knots.begin(), knots.end(), curveMesh.Knots.begin(), curveMesh.Knots.end())) {
+			return curveMesh.Patch;
+		}
+
+		const auto count = static_cast<uint32_t>(knots.size());
+		std::vector<Vertex> vertices((count/3) + (count%3 ? 1 : 0));
+		for (uint32_t i = 0; i < count; ++i) {
+			vertices[i/3].Position[i%3] = knots[i];
+		}
+
+		std::vector<uint32_t> indices;
+		indices.reserve(count > 0 ? (count-1)*2 : 0);
+		for (uint32_t i = 0; i + 1 < count; ++i) {
+			indices.push_back(i);
+			indices.push_back(i+1);
+		}
+
+		curveMesh.Knots.assign(knots.begin(), knots.end());
+		curveMesh.Patch = CreateRef<Mesh>(vertices, indices);
+		curveMesh.Patch->SetDrawMode(DrawMode::Lines);
+		return curveMesh.Patch;
+	}
+
+	void Renderer::DrawCurvePatch(const Ref<Material>& material, const Ref<Mesh>& patch, uint32_t vertexCount, int entityId)
+	{
+		VXM_PROFILE_FUNCTION();
+		s_Data.ModelBuffer.TransformMatrix = Math::Identity<Mat4>();
+		s_Data.ModelBuffer.NormalMatrix = Math::Identity<Mat4>();
+		s_Data.ModelBuffer.EntityId = entityId;
+
+		s_Data.ModelUniformBuffer->SetData(&s_Data.ModelBuffer, sizeof(RendererData::ModelData));
+		s_Data.CurveParametersBuffer->SetData(&s_Data.CurveBuffer, sizeof(RendererData::CurveParameters));
+
+		MaterialField mat = material->Handle;
+		VXM_CORE_ASSERT(mat, "The material ID({}) is not valid.", mat.GetHandle().string());
+		Ref<Material> matPtr = mat.GetAsset();
+		if(mat) {
+			s_Data.MaterialUniformBuffer->SetData(&matPtr->GetMaterialsParameters(), sizeof(MaterialParameters));
+			matPtr->Bind(false);
+			s_BindedMaterial = mat;
+		}
+
+		ShaderField shader = matPtr->GetShaderHandle();
+		VXM_CORE_ASSERT(shader, "The shader ID({}) from the material '{}' is not valid.", matPtr->GetMaterialName(), shader.GetHandle().string());
+		if (shader) {
+			shader.GetAsset()->Bind();
+			s_BindedShader = shader;
+		}
+
+		patch->Bind();
+		RenderCommand::DrawPatches(vertexCount);
+	}
+
+	void Renderer::ReleaseUnusedCurvePatches()
+	{
+		VXM_PROFILE_FUNCTION();
+		++s_Data.FrameIndex;
+		if (s_Data.FrameIndex < s_CurvePatchLifetime) return;
+		const uint64_t oldestFrame = s_Data.FrameIndex - s_CurvePatchLifetime;
+		std::erase_if(s_Data.CurveMeshes, [oldestFrame](const auto& pair) { return pair.second.LastUsedFrame < oldestFrame; });
+	}
+
 	void Renderer::EndScene() {
 		VXM_PROFILE_FUNCTION();
 
@@ -263,50 +341,17 @@ namespace Voxymore::Core {
 
 		uint32_t count = std::min(s_Data.CurveBuffer.CurveControlPoints.size(), bezierControlPoints.size());
 
-		std::vector<Vertex> vertices((count/3) + (count%3 ? 1 : 0));
-
+		// The patch of a Bézier curve holds the index of its control points.
+		std::array<float, RendererData::NUM_CONTROL_POINTS_MAX> controlPointIndices;
 		s_Data.CurveBuffer.NumberOfSegment = lineDefinition;
 		s_Data.CurveBuffer.MainCurveNumberOfControlPoint = static_cast<int>(bezierControlPoints.size());
 		for (int i = 0; i < count; ++i) {
 			s_Data.CurveBuffer.CurveControlPoints[i] = glm::vec4(bezierControlPoints[i],1);
-			vertices[i/3].Position[i%3] = float(i);
-		}
-		std::vector<uint32_t> indices;
-		indices.reserve((bezierControlPoints.size()-1)*2);
-		for (uint32_t i = 0; i < bezierControlPoints.size() - 1; ++i) {
-			indices.push_back(i);
-			indices.push_back(i+1);
-		}
-		Ref<Mesh> mesh = CreateRef<Mesh>(vertices, indices);
-
-		mesh->SetMaterial(material);
-		mesh->SetDrawMode(DrawMode::Lines);
-
-		s_Data.ModelBuffer.TransformMatrix = Math::Identity<Mat4>();
-		s_Data.ModelBuffer.NormalMatrix = Math::Identity<Mat4>();
-		s_Data.ModelBuffer.EntityId = entityId;
-
-		s_Data.ModelUniformBuffer->SetData(&s_Data.ModelBuffer, sizeof(RendererData::ModelData));
-		s_Data.MaterialUniformBuffer->SetData(&material->GetMaterialsParameters(), sizeof(MaterialParameters));
-		s_Data.CurveParametersBuffer->SetData(&s_Data.CurveBuffer, sizeof(RendererData::CurveParameters));
-
-		MaterialField mat = material->Handle;
-		VXM_CORE_ASSERT(mat, "The material ID({}) is not valid.", mat.GetHandle().string());
-		Ref<Material> matPtr = mat.GetAsset();
-		if(mat) {
-			s_Data.MaterialUniformBuffer->SetData(&matPtr->GetMaterialsParameters(), sizeof(MaterialParameters));
-			matPtr->Bind(false);
-			s_BindedMaterial = mat;
+			controlPointIndices[i] = float(i);
 		}
 
-		ShaderField shader = matPtr->GetShaderHandle();
-		VXM_CORE_ASSERT(shader, "The shader ID({}) from the material '{}' is not valid.", matPtr->GetMaterialName(), shader.GetHandle().string());
-		if (shader) {
-			shader.GetAsset()->Bind();
-			s_BindedShader = shader;
-		}
-		mesh->Bind();
-		RenderCommand::DrawPatches(vertices.size());
+		const Ref<Mesh>& patch = GetCurvePatch(std::span<const float>(controlPointIndices.data(), count));
+		DrawCurvePatch(material, patch, (count/3) + (count%3 ? 1 : 0), entityId);
 	}
 
 	void Renderer::Submit(Ref<Material> material, const glm::vec3& controlPoint0, const glm::vec3& controlPoint1, const glm::vec3& controlPoint2, const glm::vec3& controlPoint3, int lineDefinition, int entityId)
@@ -326,8 +371,6 @@ namespace Voxymore::Core {
 		uint32_t controlPointCount = std::min(s_Data.CurveBuffer.CurveControlPoints.size(), points.size());
 		uint32_t nodeCount = std::min(s_Data.CurveBuffer.CurveControlPoints.size(), nodes.size());
 
-		std::vector<Vertex> vertices((nodeCount /3) + (nodeCount %3 ? 1 : 0));
-
 		s_Data.CurveBuffer.MainCurveDegree = degree;
 		s_Data.CurveBuffer.NumberOfSegment = lineDefinition;
 		s_Data.CurveBuffer.MainCurveNumberOfControlPoint = static_cast<int>(points.size());
@@ -337,47 +380,9 @@ namespace Voxymore::Core {
 			s_Data.CurveBuffer.CurveWeights[i] = weights[i];
 		}
 
-		for (int i = 0; i < nodeCount; ++i) {
-			vertices[i/3].Position[i%3] = float(nodes[i]);
-		}
-
-		std::vector<uint32_t> indices;
-		indices.reserve((nodeCount-1)*2);
-		for (uint32_t i = 0; i < nodeCount - 1; ++i) {
-			indices.push_back(i);
-			indices.push_back(i+1);
-		}
-		Ref<Mesh> mesh = CreateRef<Mesh>(vertices, indices);
-
-		mesh->SetMaterial(material);
-		mesh->SetDrawMode(DrawMode::Lines);
-
-		s_Data.ModelBuffer.TransformMatrix = Math::Identity<Mat4>();
-		s_Data.ModelBuffer.NormalMatrix = Math::Identity<Mat4>();
-		s_Data.ModelBuffer.EntityId = entityId;
-
-		s_Data.ModelUniformBuffer->SetData(&s_Data.ModelBuffer, sizeof(RendererData::ModelData));
-		s_Data.MaterialUniformBuffer->SetData(&material->GetMaterialsParameters(), sizeof(MaterialParameters));
-		s_Data.CurveParametersBuffer->SetData(&s_Data.CurveBuffer, sizeof(RendererData::CurveParameters));
-
-		MaterialField mat = material->Handle;
-		VXM_CORE_ASSERT(mat, "The material ID({}) is not valid.", mat.GetHandle().string());
-		Ref<Material> matPtr = mat.GetAsset();
-		if(mat) {
-			s_Data.MaterialUniformBuffer->SetData(&matPtr->GetMaterialsParameters(), sizeof(MaterialParameters));
-			matPtr->Bind(false);
-			s_BindedMaterial = mat;
-		}
-
-		ShaderField shader = matPtr->GetShaderHandle();
-		VXM_CORE_ASSERT(shader, "The shader ID({}) from the material '{}' is not valid.", matPtr->GetMaterialName(), shader.GetHandle().string());
-		if (shader) {
-			shader.GetAsset()->Bind();
-			s_BindedShader = shader;
-		}
-
-		mesh->Bind();
-		RenderCommand::DrawPatches(vertices.size());
+		// The patch is only rebuilt when the knots change, the control points and weights are in the uniform block.
+		const Ref<Mesh>& patch = GetCurvePatch(std::span<const float>(nodes.data(), nodeCount));
+		DrawCurvePatch(material, patch, (nodeCount/3) + (nodeCount%3 ? 1 : 0), entityId);
 	}
 
 	void Renderer::Submit(Ref<Material> material, const CurveParams &mainCurve, const CurveParams &profileCurve, int lineDefinition, int entityId, const RendererData::TesselationControlParams& tessco, bool sampleAsRevolution)
@@ -443,50 +448,25 @@ namespace Voxymore::Core {
 //			indices.push_back(RendererData::NUM_CONTROL_POINTS_MAX + i+1);
 //		}
 
-		std::vector<Vertex> vertices {{
-				Vertex{{-0, 0, -0}, {0 ,1 ,0}, {0, 0}},
-				Vertex{{+1, 0, -0}, {0 ,1 ,0}, {1, 0}},
-				Vertex{{+1, 0, +1}, {0 ,1 ,0}, {1, 1}},
-				Vertex{{-0, 0, +1}, {0 ,1 ,0}, {0, 1}},
-		}};
-
-		std::vector<uint32_t> indices {{
-				0,1,2,3
-		}};
-		Ref<Mesh> mesh = CreateRef<Mesh>(vertices, indices);
-
-		mesh->SetMaterial(material);
-		mesh->SetDrawMode(DrawMode::Triangles);
-
-		s_Data.ModelBuffer.TransformMatrix = Math::Identity<Mat4>();
-		s_Data.ModelBuffer.NormalMatrix = Math::Identity<Mat4>();
-		s_Data.ModelBuffer.EntityId = entityId;
-
-		s_Data.ModelUniformBuffer->SetData(&s_Data.ModelBuffer, sizeof(RendererData::ModelData));
-		s_Data.MaterialUniformBuffer->SetData(&material->GetMaterialsParameters(), sizeof(MaterialParameters));
-		s_Data.CurveParametersBuffer->SetData(&s_Data.CurveBuffer, sizeof(RendererData::CurveParameters));
+		if (!s_Data.SurfacePatch) {
+			std::vector<Vertex> vertices {{
+					Vertex{{-0, 0, -0}, {0 ,1 ,0}, {0, 0}},
+					Vertex{{+1, 0, -0}, {0 ,1 ,0}, {1, 0}},
+					Vertex{{+1, 0, +1}, {0 ,1 ,0}, {1, 1}},
+					Vertex{{-0, 0, +1}, {0 ,1 ,0}, {0, 1}},
+			}};
+
+			std::vector<uint32_t> indices {{
+					0,1,2,3
+			}};
+			s_Data.SurfacePatch = CreateRef<Mesh>(vertices, indices);
+			s_Data.SurfacePatch->SetDrawMode(DrawMode::Triangles);
+		}
 
 		s_Data.TessCoBuffer = tessco;
 		s_Data.TessCoParametersBuffer->SetData(&s_Data.TessCoBuffer);
 
-		MaterialField mat = material->Handle;
-		VXM_CORE_ASSERT(mat, "The material ID({}) is not valid.", mat.GetHandle().string());
-		Ref<Material> matPtr = mat.GetAsset();
-		if(mat) {
-			s_Data.MaterialUniformBuffer->SetData(&matPtr->GetMaterialsParameters(), sizeof(MaterialParameters));
-			matPtr->Bind(false);
-			s_BindedMaterial = mat;
-		}
-
-		ShaderField shader = matPtr->GetShaderHandle();
-		VXM_CORE_ASSERT(shader, "The shader ID({}) from the material '{}' is not valid.", matPtr->GetMaterialName(), shader.GetHandle().string());
-		if (shader) {
-			shader.GetAsset()->Bind();
-			s_BindedShader = shader;
-		}
-
-		mesh->Bind();
-		RenderCommand::DrawPatches(vertices.size());
+		DrawCurvePatch(material, s_Data.SurfacePatch, 4, entityId);
 	}
 
 	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
@@ -0,0 +1,79 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+// Compiled with AVX2 enabled (see Core/CMakeLists.txt), only called when the CPU supports it.
+// Only the kernel header may be included here, see BoxOverlapKernel.hpp.
+
+#include "BoxOverlapKernel.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VXM_BOX_OVERLAP_AVX2
+#endif
+
+namespace Voxymore::Core::BoxOverlapKernel
+{
+#ifdef VXM_BOX_OVERLAP_AVX2
+	namespace
+	{
+#ifdef VXM_DOUBLE
+		struct AVX2Ops
+		{
+			using Value = __m256d;
+			using Mask = __m256d;
+			static constexpr size_t Width = 4;
+
+			static inline Value Load(const Real* p) { return _mm256_loadu_pd(p); }
+			static inline Value Set(Real v) { return _mm256_set1_pd(v); }
+			static inline Value Add(Value a, Value b) { return _mm256_add_pd(a, b); }
+			static inline Value Sub(Value a, Value b) { return _mm256_sub_pd(a, b); }
+			static inline Value Mul(Value a, Value b) { return _mm256_mul_pd(a, b); }
+			static inline Value Abs(Value a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+			static inline Mask Greater(Value a, Value b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+			static inline Mask Or(Mask a, Mask b) { return _mm256_or_pd(a, b); }
+			static inline bool All(Mask m) { return _mm256_movemask_pd(m) == 0xF; }
+			static inline void StoreOverlaps(Mask separated, uint8_t* results)
+			{
+				const int bits = _mm256_movemask_pd(separated);
+				for (size_t i = 0; i < Width; ++i) results[i] = (bits >> i) & 1 ? 0 : 1;
+			}
+		};
+#else
+		struct AVX2Ops
+		{
+			using Value = __m256;
+			using Mask = __m256;
+			static constexpr size_t Width = 8;
+
+			static inline Value Load(const Real* p) { return _mm256_loadu_ps(p); }
+			static inline Value Set(Real v) { return _mm256_set1_ps(v); }
+			static inline Value Add(Value a, Value b) { return _mm256_add_ps(a, b); }
+			static inline Value Sub(Value a, Value b) { return _mm256_sub_ps(a, b); }
+			static inline Value Mul(Value a, Value b) { return _mm256_mul_ps(a, b); }
+			static inline Value Abs(Value a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+			static inline Mask Greater(Value a, Value b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+			static inline Mask Or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+			static inline bool All(Mask m) { return _mm256_movemask_ps(m) == 0xFF; }
+			static inline void StoreOverlaps(Mask separated, uint8_t* results)
+			{
+				const int bits = _mm256_movemask_ps(separated);
+				for (size_t i = 0; i < Width; ++i) results[i] = (bits >> i) & 1 ? 0 : 1;
+			}
+		};
+#endif
+	}
+
+	size_t TestAVX2(const Input& input)
+	{
+		const size_t simdEnd = input.count - input.count % AVX2Ops::Width;
+		TestRange<AVX2Ops>(input, 0, simdEnd);
+		return simdEnd;
+	}
+#else
+	size_t TestAVX2(const Input&)
+	{
+		return 0;
+	}
+#endif
+} // namespace Voxymore::Core::BoxOverlapKernel
@@ -0,0 +1,147 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/Collisions/BoxOverlapBatch.hpp"
+#include "BoxOverlapKernel.hpp"
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#define VXM_BOX_OVERLAP_CPUID_MSVC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VXM_BOX_OVERLAP_CPUID_GNU
+#endif
+
+namespace Voxymore::Core
+{
+	namespace BoxOverlapKernel
+	{
+		static_assert(std::is_same_v<Real, Core::Real>, "The kernels must use the precision of the engine.");
+		static_assert(CenterIndex == BoxOverlapBatch::CenterIndex && AxisIndex == BoxOverlapBatch::AxisIndex && ExtentIndex == BoxOverlapBatch::ExtentIndex && ComponentCount == BoxOverlapBatch::ComponentCount, "The kernels must use the layout of the batch.");
+
+		void TestScalar(const Input& input, size_t begin, size_t end)
+		{
+			TestRange<ScalarOps>(input, begin, end);
+		}
+	}
+
+	BoxOverlapBatch::BoxOverlapBatch() : m_SimdLevel(GetSupportedSimdLevel())
+	{
+	}
+
+	SimdLevel BoxOverlapBatch::GetSupportedSimdLevel()
+	{
+		static const SimdLevel s_Level = []() {
+#if defined(VXM_BOX_OVERLAP_CPUID_GNU)
+			__builtin_cpu_init();
+			if(__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+			if(__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE4;
+			return SimdLevel::Scalar;
+#elif defined(VXM_BOX_OVERLAP_CPUID_MSVC)
+			int info[4];
+			__cpuid(info, 0);
+			const int maxLeaf = info[0];
+			__cpuid(info, 1);
+			const bool sse41 = (info[2] & (1 << 19)) != 0;
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+			bool avx2 = false;
+			// The OS must also save the YMM registers on context switches.
+			if(maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = (info[1] & (1 << 5)) != 0;
+			}
+			if(avx2) return SimdLevel::AVX2;
+			if(sse41) return SimdLevel::SSE4;
+			return SimdLevel::Scalar;
+#else
+			return SimdLevel::Scalar;
+#endif
+		}();
+		return s_Level;
+	}
+
+	void BoxOverlapBatch::SetSimdLevel(SimdLevel level)
+	{
+		m_SimdLevel = static_cast<int>(level) > static_cast<int>(GetSupportedSimdLevel()) ? GetSupportedSimdLevel() : level;
+	}
+
+	uint32_t BoxOverlapBatch::Add(const Box& one, const Box& two)
+	{
+		uint32_t index = static_cast<uint32_t>(size());
+		AddBox(m_One, one);
+		AddBox(m_Two, two);
+		m_Results.push_back(0);
+		return index;
+	}
+
+	void BoxOverlapBatch::AddBox(std::array<std::vector<Real>, ComponentCount>& arrays, const Box& box)
+	{
+		const Vec3 position = box.GetPosition();
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			arrays[CenterIndex + c].push_back(position[c]);
+		}
+
+		for (int32_t k = 0; k < 3; ++k)
+		{
+			Vec3 axis = box.GetAxis(k);
+			Real length = Math::Magnitude(axis);
+			if(length > REAL_EPSILON) axis /= length;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				arrays[AxisIndex + k * 3 + c].push_back(axis[c]);
+			}
+			arrays[ExtentIndex + k].push_back(box.m_HalfSize[k] * length);
+		}
+	}
+
+	const std::vector<uint8_t>& BoxOverlapBatch::Test()
+	{
+		VXM_PROFILE_FUNCTION();
+		if(empty()) return m_Results;
+
+		BoxOverlapKernel::Input input{};
+		for (uint32_t c = 0; c < ComponentCount; ++c)
+		{
+			input.one[c] = m_One[c].data();
+			input.two[c] = m_Two[c].data();
+		}
+		input.results = m_Results.data();
+		input.count = m_Results.size();
+
+		size_t tested = 0;
+		switch (m_SimdLevel)
+		{
+			case SimdLevel::AVX2: tested = BoxOverlapKernel::TestAVX2(input); break;
+			case SimdLevel::SSE4: tested = BoxOverlapKernel::TestSSE4(input); break;
+			default: break;
+		}
+		// The pairs left over by the SIMD kernels are tested here, out of the files built for an instruction set.
+		BoxOverlapKernel::TestScalar(input, tested, input.count);
+		return m_Results;
+	}
+
+	void BoxOverlapBatch::Reserve(size_t count)
+	{
+		for (uint32_t c = 0; c < ComponentCount; ++c)
+		{
+			m_One[c].reserve(count);
+			m_Two[c].reserve(count);
+		}
+		m_Results.reserve(count);
+	}
+
+	void BoxOverlapBatch::Clear()
+	{
+		for (uint32_t c = 0; c < ComponentCount; ++c)
+		{
+			m_One[c].clear();
+			m_Two[c].clear();
+		}
+		m_Results.clear();
+	}
+} // namespace Voxymore::Core
@@ -0,0 +1,159 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#pragma once
+
+// This header is included by the files built with AVX2 or SSE4.1 enabled.
+// It must stay free of shared inline code (glm, Math, profiling, std containers):
+// an inline function instantiated in those files could be the copy kept by the linker for every caller,
+// and run on a CPU that doesn't support the instruction set.
+// Everything defined here lives in an anonymous namespace so each file keeps its own copy.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Voxymore::Core::BoxOverlapKernel
+{
+#ifdef VXM_DOUBLE
+	typedef double Real;
+#else
+	typedef float Real;
+#endif
+
+	// The layout of the arrays of a BoxOverlapBatch, see CenterIndex.
+	static constexpr uint32_t CenterIndex = 0;
+	static constexpr uint32_t AxisIndex = 3;
+	static constexpr uint32_t ExtentIndex = 12;
+	static constexpr uint32_t ComponentCount = 15;
+
+	/**
+	 * The arrays of a BoxOverlapBatch.
+	 */
+	struct Input
+	{
+		const Real* one[ComponentCount];
+		const Real* two[ComponentCount];
+		uint8_t* results;
+		size_t count;
+	};
+
+	void TestScalar(const Input& input, size_t begin, size_t end);
+	/**
+	 * @return The number of pairs tested, the remaining ones being left to TestScalar.
+	 */
+	size_t TestSSE4(const Input& input);
+	/**
+	 * @return The number of pairs tested, the remaining ones being left to TestScalar.
+	 */
+	size_t TestAVX2(const Input& input);
+
+	namespace
+	{
+		// Added to the absolute values of the rotation so the cross products of nearly parallel edges don't separate the boxes.
+		static constexpr Real s_Epsilon = 1e-5;
+
+		struct ScalarOps
+		{
+			using Value = Real;
+			using Mask = bool;
+			static constexpr size_t Width = 1;
+
+			static inline Value Load(const Real* p) { return *p; }
+			static inline Value Set(Real v) { return v; }
+			static inline Value Add(Value a, Value b) { return a + b; }
+			static inline Value Sub(Value a, Value b) { return a - b; }
+			static inline Value Mul(Value a, Value b) { return a * b; }
+			static inline Value Abs(Value a) { return a < 0 ? -a : a; }
+			static inline Mask Greater(Value a, Value b) { return a > b; }
+			static inline Mask Or(Mask a, Mask b) { return a || b; }
+			static inline bool All(Mask m) { return m; }
+			static inline void StoreOverlaps(Mask separated, uint8_t* results) { *results = separated ? 0 : 1; }
+		};
+
+		/**
+		 * @brief Test the pairs [begin, end) with the operations of Ops, end - begin being a multiple of Ops::Width.
+		 *
+		 * Gottschalk's OBB test: everything is expressed in the space of the first box
+		 * so each of the 15 axes only needs a few products of the rotation between the boxes.
+		 */
+		template<class Ops>
+		inline void TestRange(const Input& input, size_t begin, size_t end)
+		{
+			using V = typename Ops::Value;
+			using M = typename Ops::Mask;
+			const V epsilon = Ops::Set(s_Epsilon);
+
+			for (size_t i = begin; i < end; i += Ops::Width)
+			{
+				auto one = [&](uint32_t c) { return Ops::Load(input.one[c] + i); };
+				auto two = [&](uint32_t c) { return Ops::Load(input.two[c] + i); };
+				auto dot = [](V ax, V ay, V az, V bx, V by, V bz) { return Ops::Add(Ops::Add(Ops::Mul(ax, bx), Ops::Mul(ay, by)), Ops::Mul(az, bz)); };
+
+				V a[3][3], b[3][3], ea[3], eb[3];
+				for (uint32_t k = 0; k < 3; ++k)
+				{
+					for (uint32_t c = 0; c < 3; ++c)
+					{
+						a[k][c] = one(AxisIndex + k * 3 + c);
+						b[k][c] = two(AxisIndex + k * 3 + c);
+					}
+					ea[k] = one(ExtentIndex + k);
+					eb[k] = two(ExtentIndex + k);
+				}
+
+				const V dx = Ops::Sub(two(CenterIndex + 0), one(CenterIndex + 0));
+				const V dy = Ops::Sub(two(CenterIndex + 1), one(CenterIndex + 1));
+				const V dz = Ops::Sub(two(CenterIndex + 2), one(CenterIndex + 2));
+
+				V r[3][3], absR[3][3], t[3];
+				for (uint32_t k = 0; k < 3; ++k)
+				{
+					for (uint32_t j = 0; j < 3; ++j)
+					{
+						r[k][j] = dot(a[k][0], a[k][1], a[k][2], b[j][0], b[j][1], b[j][2]);
+						absR[k][j] = Ops::Add(Ops::Abs(r[k][j]), epsilon);
+					}
+					t[k] = dot(dx, dy, dz, a[k][0], a[k][1], a[k][2]);
+				}
+
+				// Axes of the first box.
+				M separated = Ops::Greater(Ops::Abs(t[0]), Ops::Add(ea[0], dot(eb[0], eb[1], eb[2], absR[0][0], absR[0][1], absR[0][2])));
+				separated = Ops::Or(separated, Ops::Greater(Ops::Abs(t[1]), Ops::Add(ea[1], dot(eb[0], eb[1], eb[2], absR[1][0], absR[1][1], absR[1][2]))));
+				separated = Ops::Or(separated, Ops::Greater(Ops::Abs(t[2]), Ops::Add(ea[2], dot(eb[0], eb[1], eb[2], absR[2][0], absR[2][1], absR[2][2]))));
+
+				// Axes of the second box.
+				if(!Ops::All(separated))
+				{
+					for (uint32_t j = 0; j < 3; ++j)
+					{
+						V ra = dot(ea[0], ea[1], ea[2], absR[0][j], absR[1][j], absR[2][j]);
+						V distance = Ops::Abs(dot(t[0], t[1], t[2], r[0][j], r[1][j], r[2][j]));
+						separated = Ops::Or(separated, Ops::Greater(distance, Ops::Add(ra, eb[j])));
+					}
+				}
+
+				// Cross products of the axes, A[k] x B[j].
+				if(!Ops::All(separated))
+				{
+					for (uint32_t k = 0; k < 3; ++k)
+					{
+						const uint32_t k1 = (k + 1) % 3;
+						const uint32_t k2 = (k + 2) % 3;
+						for (uint32_t j = 0; j < 3; ++j)
+						{
+							const uint32_t j1 = (j + 1) % 3;
+							const uint32_t j2 = (j + 2) % 3;
+							V ra = Ops::Add(Ops::Mul(ea[k1], absR[k2][j]), Ops::Mul(ea[k2], absR[k1][j]));
+							V rb = Ops::Add(Ops::Mul(eb[j1], absR[k][j2]), Ops::Mul(eb[j2], absR[k][j1]));
+							V distance = Ops::Abs(Ops::Sub(Ops::Mul(t[k2], r[k1][j]), Ops::Mul(t[k1], r[k2][j])));
+							separated = Ops::Or(separated, Ops::Greater(distance, Ops::Add(ra, rb)));
+						}
+					}
+				}
+
+				Ops::StoreOverlaps(separated, input.results + i);
+			}
+		}
+	}
+} // namespace Voxymore::Core::BoxOverlapKernel
@@ -0,0 +1,79 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+// Compiled with SSE4.1 enabled (see Core/CMakeLists.txt), only called when the CPU supports it.
+// Only the kernel header may be included here, see BoxOverlapKernel.hpp.
+
+#include "BoxOverlapKernel.hpp"
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)))
+#include <smmintrin.h>
+#define VXM_BOX_OVERLAP_SSE4
+#endif
+
+namespace Voxymore::Core::BoxOverlapKernel
+{
+#ifdef VXM_BOX_OVERLAP_SSE4
+	namespace
+	{
+#ifdef VXM_DOUBLE
+		struct SSE4Ops
+		{
+			using Value = __m128d;
+			using Mask = __m128d;
+			static constexpr size_t Width = 2;
+
+			static inline Value Load(const Real* p) { return _mm_loadu_pd(p); }
+			static inline Value Set(Real v) { return _mm_set1_pd(v); }
+			static inline Value Add(Value a, Value b) { return _mm_add_pd(a, b); }
+			static inline Value Sub(Value a, Value b) { return _mm_sub_pd(a, b); }
+			static inline Value Mul(Value a, Value b) { return _mm_mul_pd(a, b); }
+			static inline Value Abs(Value a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+			static inline Mask Greater(Value a, Value b) { return _mm_cmpgt_pd(a, b); }
+			static inline Mask Or(Mask a, Mask b) { return _mm_or_pd(a, b); }
+			static inline bool All(Mask m) { return _mm_movemask_pd(m) == 0x3; }
+			static inline void StoreOverlaps(Mask separated, uint8_t* results)
+			{
+				const int bits = _mm_movemask_pd(separated);
+				for (size_t i = 0; i < Width; ++i) results[i] = (bits >> i) & 1 ? 0 : 1;
+			}
+		};
+#else
+		struct SSE4Ops
+		{
+			using Value = __m128;
+			using Mask = __m128;
+			static constexpr size_t Width = 4;
+
+			static inline Value Load(const Real* p) { return _mm_loadu_ps(p); }
+			static inline Value Set(Real v) { return _mm_set1_ps(v); }
+			static inline Value Add(Value a, Value b) { return _mm_add_ps(a, b); }
+			static inline Value Sub(Value a, Value b) { return _mm_sub_ps(a, b); }
+			static inline Value Mul(Value a, Value b) { return _mm_mul_ps(a, b); }
+			static inline Value Abs(Value a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+			static inline Mask Greater(Value a, Value b) { return _mm_cmpgt_ps(a, b); }
+			static inline Mask Or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+			static inline bool All(Mask m) { return _mm_movemask_ps(m) == 0xF; }
+			static inline void StoreOverlaps(Mask separated, uint8_t* results)
+			{
+				const int bits = _mm_movemask_ps(separated);
+				for (size_t i = 0; i < Width; ++i) results[i] = (bits >> i) & 1 ? 0 : 1;
+			}
+		};
+#endif
+	}
+
+	size_t TestSSE4(const Input& input)
+	{
+		const size_t simdEnd = input.count - input.count % SSE4Ops::Width;
+		TestRange<SSE4Ops>(input, 0, simdEnd);
+		return simdEnd;
+	}
+#else
+	size_t TestSSE4(const Input&)
+	{
+		return 0;
+	}
+#endif
+} // namespace Voxymore::Core::BoxOverlapKernel
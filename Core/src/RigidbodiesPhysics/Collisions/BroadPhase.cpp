@@ -0,0 +1,43 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/Collisions/BroadPhase.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/DynamicBVH.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/SweepAndPrune.hpp"
+#include <utility>
+
+namespace Voxymore::Core
+{
+	BroadPhase::BroadPhase(Real margin, Real displacementMultiplier) : m_Margin(margin), m_DisplacementMultiplier(displacementMultiplier)
+	{
+	}
+
+	Scope<BroadPhase> BroadPhase::Create(BroadPhaseType type)
+	{
+		VXM_PROFILE_FUNCTION();
+		switch (type) {
+			case BroadPhaseType::DynamicBVH: return CreateScope<DynamicBVH>();
+			case BroadPhaseType::SweepAndPrune: return CreateScope<SweepAndPrune>();
+		}
+
+		VXM_CORE_ERROR("The broadphase type {0} is not supported.", (int)type);
+		return CreateScope<DynamicBVH>();
+	}
+
+	BoundingBox BroadPhase::ComputeFatBoundingBox(const BoundingBox &box, const Vec3 &displacement) const
+	{
+		VXM_PROFILE_FUNCTION();
+		BoundingBox fat = box;
+		fat.Inflate(m_Margin);
+		fat.Stretch(displacement * m_DisplacementMultiplier);
+		return fat;
+	}
+
+	uint64_t BroadPhase::MakePair(uint32_t a, uint32_t b)
+	{
+		if(a > b) std::swap(a, b);
+		return (static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b);
+	}
+} // namespace Voxymore::Core
+
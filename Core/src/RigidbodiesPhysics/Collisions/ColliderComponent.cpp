@@ -4,6 +4,8 @@
 
 #include "Voxymore/RigidbodiesPhysics/Components/ColliderComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
+#include "Voxymore/Components/ModelComponent.hpp"
+#include "Voxymore/Components/PrimitiveComponent.hpp"
 #include "Voxymore/ImGui/ImGuiLib.hpp"
 #include "Voxymore/Core/YamlHelper.hpp"
 #include "Voxymore/Core/TypeHelpers.hpp"
@@ -12,6 +14,63 @@
 
 namespace Voxymore::Core
 {
+	namespace
+	{
+		void GatherModelPositions(const Ref<Model>& model, const Node& node, const Mat4& transform, std::vector<Vec3>& points)
+		{
+			const Mat4 currentTransform = transform * Mat4(node.transform);
+			if(node.HasMesh())
+			{
+				for (const auto& mesh : model->GetMeshGroup(node.GetMeshIndex()))
+				{
+					if(!mesh) continue;
+					for (const glm::vec3& position : mesh.GetAsset()->GetPositions())
+					{
+						points.push_back(Math::TransformPoint(currentTransform, Vec3(position)));
+					}
+				}
+			}
+
+			for (const int i : node.children)
+			{
+				GatherModelPositions(model, model->GetNode(i), currentTransform, points);
+			}
+		}
+
+		/**
+		 * @brief The position of the vertices of the mesh of the entity, in the local space of the entity.
+		 */
+		std::vector<Vec3> GatherMeshPositions(Entity e)
+		{
+			VXM_PROFILE_FUNCTION();
+			std::vector<Vec3> points;
+			if(e.HasComponent<PrimitiveComponent>())
+			{
+				auto& primitive = e.GetComponent<PrimitiveComponent>();
+				if(primitive.IsLoaded())
+				{
+					for (const glm::vec3& position : primitive.GetMesh()->GetPositions())
+					{
+						points.emplace_back(position);
+					}
+				}
+			}
+			if(e.HasComponent<ModelComponent>())
+			{
+				auto& model = e.GetComponent<ModelComponent>();
+				if(model.IsValid())
+				{
+					Ref<Model> asset = model.GetModel();
+					for (int nodeIndex : asset->GetDefaultScene())
+					{
+						GatherModelPositions(asset, asset->GetNode(nodeIndex), Math::Identity<Mat4>(), points);
+					}
+				}
+			}
+			return points;
+		}
+	}
+
 	void ColliderComponent::DeserializeComponent(YAML::Node& node, Entity e)
 	{
 		VXM_PROFILE_FUNCTION();
@@ -42,13 +101,35 @@ namespace Voxymore::Core
 				box.m_Transform = &e.GetComponent<TransformComponent>();
 				break;
 			}
+			case PrimitiveCollider::ConvexHull: {
+				m_Collider = ConvexHull();
+				ConvexHull& hull = std::get<ConvexHull>(m_Collider);
+				auto verticesNode = node["Vertices"];
+				if(verticesNode && verticesNode.IsSequence())
+				{
+					std::vector<Vec3> vertices;
+					vertices.reserve(verticesNode.size());
+					for(auto vertexNode : verticesNode)
+					{
+						vertices.push_back(vertexNode.as<Vec3>(Vec3{0,0,0}));
+					}
+					hull.SetVertices(std::move(vertices));
+				}
+				hull.m_Body = e.HasComponent<RigidbodyComponent>() ? reinterpret_cast<Rigidbody*>(&e.GetComponent<RigidbodyComponent>()) : nullptr;
+				hull.m_Transform = &e.GetComponent<TransformComponent>();
+				break;
+			}
 		}
+
+		DeserializeField(node, m_Filter.category, "CollisionCategory", uint32_t, VXM_DEFAULT_COLLISION_CATEGORY);
+		DeserializeField(node, m_Filter.mask, "CollisionMask", uint32_t, VXM_DEFAULT_COLLISION_MASK);
+		DeserializeField(node, m_Filter.isTrigger, "IsTrigger", bool, false);
 	}
 
 	void ColliderComponent::SerializeComponent(YAML::Emitter& out, Entity e)
 	{
 		VXM_PROFILE_FUNCTION();
-		PrimitiveCollider::Type t = std::visit(overloads{[](const Box& box){return PrimitiveCollider::Type::Box;}, [](const Sphere& sphere){return PrimitiveCollider::Type::Sphere;}, [](const Plane& plane){return PrimitiveCollider::Type::Plane;}}, m_Collider);
+		PrimitiveCollider::Type t = std::visit(overloads{[](const Box& box){return PrimitiveCollider::Type::Box;}, [](const Sphere& sphere){return PrimitiveCollider::Type::Sphere;}, [](const Plane& plane){return PrimitiveCollider::Type::Plane;}, [](const ConvexHull& hull){return PrimitiveCollider::Type::ConvexHull;}}, m_Collider);
 		out << KEYVAL("Type", (int)t);
 		auto useSphere = [&out](const Sphere& sphere) -> void {
 			out << KEYVAL("Radius", sphere.m_Radius);
@@ -60,21 +141,116 @@ namespace Voxymore::Core
 			out << KEYVAL("Normal",plane.m_Normal);
 			out << KEYVAL("Offset",plane.m_Offset);
 		};
-		std::visit(overloads{useBox, useSphere, usePlane}, m_Collider);
+		auto useHull = [&out](const ConvexHull& hull) -> void {
+			out << KEYVAL("Vertices", YAML::BeginSeq);
+			{
+				for (const auto& v : hull.GetLocalVertices()) {
+					out << v;
+				}
+				out << YAML::EndSeq;
+			}
+		};
+		std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
+
+		out << KEYVAL("CollisionCategory", m_Filter.category);
+		out << KEYVAL("CollisionMask", m_Filter.mask);
+		out << KEYVAL("IsTrigger", m_Filter.isTrigger);
+	}
+
+	void ColliderComponent::DeserializeComponent(BinaryReader& reader, Entity e)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto t = (PrimitiveCollider::Type) reader.Read<int32_t>();
+		switch (t) {
+			case PrimitiveCollider::Sphere: {
+				m_Collider = Sphere();
+				reader.Read(std::get<Sphere>(m_Collider).m_Radius);
+				break;
+			}
+			case PrimitiveCollider::Plane: {
+				m_Collider = Plane();
+				Plane& plane = std::get<Plane>(m_Collider);
+				reader.Read(plane.m_Normal);
+				reader.Read(plane.m_Offset);
+				break;
+			}
+			case PrimitiveCollider::Box: {
+				m_Collider = Box();
+				reader.Read(std::get<Box>(m_Collider).m_HalfSize);
+				break;
+			}
+			case PrimitiveCollider::ConvexHull: {
+				m_Collider = ConvexHull();
+				size_t size = reader.Read<uint32_t>() * sizeof(Vec3);
+				std::vector<Vec3> vertices;
+				if(size <= reader.Remaining())
+				{
+					vertices.resize(size / sizeof(Vec3));
+					reader.ReadArray(std::span<Vec3>(vertices));
+				}
+				else
+				{
+					// Truncated hull, skipping fails the reader.
+					reader.Skip(size);
+				}
+				std::get<ConvexHull>(m_Collider).SetVertices(std::move(vertices));
+				break;
+			}
+			default: {
+				VXM_CORE_ERROR("Unknown collider type {0}.", (int)t);
+				m_Collider = Box();
+				break;
+			}
+		}
+		std::visit([&e](PrimitiveCollider& collider) {
+			collider.m_Body = e.HasComponent<RigidbodyComponent>() ? reinterpret_cast<Rigidbody*>(&e.GetComponent<RigidbodyComponent>()) : nullptr;
+			collider.m_Transform = &e.GetComponent<TransformComponent>();
+		}, m_Collider);
+
+		reader.Read(m_Filter.category);
+		reader.Read(m_Filter.mask);
+		m_Filter.isTrigger = reader.Read<uint8_t>() != 0;
+	}
+
+	void ColliderComponent::SerializeComponent(BinaryWriter& writer, Entity e)
+	{
+		VXM_PROFILE_FUNCTION();
+		PrimitiveCollider::Type t = std::visit(overloads{[](const Box& box){return PrimitiveCollider::Type::Box;}, [](const Sphere& sphere){return PrimitiveCollider::Type::Sphere;}, [](const Plane& plane){return PrimitiveCollider::Type::Plane;}, [](const ConvexHull& hull){return PrimitiveCollider::Type::ConvexHull;}}, m_Collider);
+		writer.Write<int32_t>(t);
+		auto useSphere = [&writer](const Sphere& sphere) -> void {
+			writer.Write(sphere.m_Radius);
+		};
+		auto useBox = [&writer](const Box& box) -> void {
+			writer.Write(box.m_HalfSize);
+		};
+		auto usePlane = [&writer](const Plane& plane) -> void {
+			writer.Write(plane.m_Normal);
+			writer.Write(plane.m_Offset);
+		};
+		auto useHull = [&writer](const ConvexHull& hull) -> void {
+			writer.Write<uint32_t>(static_cast<uint32_t>(hull.GetLocalVertices().size()));
+			writer.WriteArray(std::span<const Vec3>(hull.GetLocalVertices()));
+		};
+		std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
+
+		writer.Write(m_Filter.category);
+		writer.Write(m_Filter.mask);
+		writer.Write<uint8_t>(m_Filter.isTrigger);
 	}
 
 	bool ColliderComponent::OnImGuiRender(Entity e)
 	{
 		VXM_PROFILE_FUNCTION();
-		PrimitiveCollider::Type t = std::visit(overloads{[](const Box& box){return PrimitiveCollider::Type::Box;}, [](const Sphere& sphere){return PrimitiveCollider::Type::Sphere;}, [](const Plane& plane){return PrimitiveCollider::Type::Plane;}}, m_Collider);
+		PrimitiveCollider::Type t = std::visit(overloads{[](const Box& box){return PrimitiveCollider::Type::Box;}, [](const Sphere& sphere){return PrimitiveCollider::Type::Sphere;}, [](const Plane& plane){return PrimitiveCollider::Type::Plane;}, [](const ConvexHull& hull){return PrimitiveCollider::Type::ConvexHull;}}, m_Collider);
 
-		const char* elems[3] = {"Sphere","Plane","Box"};
-		if(ImGui::Combo("Type", (int*)&t, elems, 3))
+		const char* elems[4] = {"Sphere","Plane","Box","Convex Hull"};
+		if(ImGui::Combo("Type", (int*)&t, elems, 4))
 		{
 			switch (t) {
 				case PrimitiveCollider::Sphere: m_Collider = Sphere(); break;
 				case PrimitiveCollider::Plane: m_Collider = Plane(); break;
 				case PrimitiveCollider::Box: m_Collider = Box(); break;
+				case PrimitiveCollider::ConvexHull: m_Collider = ConvexHull(); break;
 			}
 		}
 
@@ -96,7 +272,44 @@ namespace Voxymore::Core
 			if(!box.m_Transform) box.m_Transform = &e.GetComponent<TransformComponent>();
 			return ImGuiLib::DragReal3("Half Size", glm::value_ptr(box.m_HalfSize));
 		};
-		return std::visit(overloads{useBox, useSphere, usePlane}, m_Collider);
+		auto useHull = [&e](ConvexHull& hull) -> bool {
+			if(!hull.m_Body) hull.m_Body = e.HasComponent<RigidbodyComponent>() ? reinterpret_cast<Rigidbody*>(&e.GetComponent<RigidbodyComponent>()) : nullptr;
+			if(!hull.m_Transform) hull.m_Transform = &e.GetComponent<TransformComponent>();
+			ImGui::Text("%llu vertices", (unsigned long long)hull.GetLocalVertices().size());
+			bool changed = false;
+			if(ImGui::Button("Fit Mesh"))
+			{
+				std::vector<Vec3> points = GatherMeshPositions(e);
+				if(!points.empty())
+				{
+					hull.SetVertices(std::move(points));
+					changed = true;
+				}
+			}
+			if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+			{
+				ImGui::SetTooltip("Build the hull from the vertices of the primitive or the model of the entity.");
+			}
+			return changed;
+		};
+		bool changed = std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
+
+		changed |= ImGui::InputScalar("Category", ImGuiDataType_U32, &m_Filter.category, nullptr, nullptr, "%08X", ImGuiInputTextFlags_CharsHexadecimal);
+		if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+		{
+			ImGui::SetTooltip("The layers the collider belongs to, one bit per layer.");
+		}
+		changed |= ImGui::InputScalar("Mask", ImGuiDataType_U32, &m_Filter.mask, nullptr, nullptr, "%08X", ImGuiInputTextFlags_CharsHexadecimal);
+		if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+		{
+			ImGui::SetTooltip("The layers the collider collides with, one bit per layer.");
+		}
+		changed |= ImGui::Checkbox("Trigger", &m_Filter.isTrigger);
+		if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+		{
+			ImGui::SetTooltip("A trigger doesn't collide, its overlaps are only reported.");
+		}
+		return changed;
 	}
 
 	BoundingSphere ColliderComponent::GetBoundingSphere() const
@@ -105,8 +318,9 @@ namespace Voxymore::Core
 		auto useSphere = [](const Sphere& sphere) -> BoundingSphere { return BoundingSphere(sphere.GetPosition(), sphere.m_Radius);};
 		auto useBox = [](const Box& box) -> BoundingSphere { return BoundingSphere(box.GetVertices());};
 		auto usePlane = [](const Plane& plane) -> BoundingSphere { return BoundingSphere(plane.GetPosition(), -1);};
+		auto useHull = [](const ConvexHull& hull) -> BoundingSphere { return hull.GetBoundingSphere();};
 
-		return std::visit(overloads{useBox, useSphere, usePlane}, m_Collider);
+		return std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
 	}
 
 	BoundingBox ColliderComponent::GetBoundingBox() const
@@ -115,8 +329,9 @@ namespace Voxymore::Core
 		auto useSphere = [](const Sphere& sphere) -> BoundingBox { return BoundingBox(sphere.GetPosition() - Vec3(sphere.m_Radius), sphere.GetPosition() + Vec3(sphere.m_Radius));};
 		auto useBox = [](const Box& box) -> BoundingBox { return BoundingBox(box.GetVertices());};
 		auto usePlane = [](const Plane& plane) -> BoundingBox { return BoundingBox();};
+		auto useHull = [](const ConvexHull& hull) -> BoundingBox { return hull.GetBoundingBox();};
 
-		return std::visit(overloads{useBox, useSphere, usePlane}, m_Collider);
+		return std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
 	}
 
 	void ColliderComponent::SetTransform(TransformComponent* tc)
@@ -125,8 +340,9 @@ namespace Voxymore::Core
 		auto useSphere = [tc](Sphere& sphere) -> void { sphere.m_Transform = tc; sphere.CacheMatrix(); };
 		auto useBox = [tc](Box& box) -> void { box.m_Transform = tc; box.CacheMatrix(); };
 		auto usePlane = [tc](Plane& plane) -> void { plane.m_Transform = tc; plane.CacheMatrix(); };
+		auto useHull = [tc](ConvexHull& hull) -> void { hull.m_Transform = tc; hull.CacheMatrix(); };
 
-		std::visit(overloads{useBox, useSphere, usePlane}, m_Collider);
+		std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
 	}
 
 	void ColliderComponent::SetRigidbody(RigidbodyComponent* rc)
@@ -135,7 +351,8 @@ namespace Voxymore::Core
 		auto useSphere = [rc](Sphere& sphere) -> void { sphere.m_Body = rc; };
 		auto useBox = [rc](Box& box) -> void { box.m_Body = rc; };
 		auto usePlane = [rc](Plane& plane) -> void { plane.m_Body = rc; };
+		auto useHull = [rc](ConvexHull& hull) -> void { hull.m_Body = rc; };
 
-		std::visit(overloads{useBox, useSphere, usePlane}, m_Collider);
+		std::visit(overloads{useBox, useSphere, usePlane, useHull}, m_Collider);
 	}
 } // namespace Voxymore::Core
@@ -25,6 +25,14 @@ namespace Voxymore::Core
 		});
 #endif
 	}
+	bool IntersectionDetector::BoundingBoxAndHalfSpace(const BoundingBox& box, const Plane& plane)
+	{
+		// The distance of the center to the plane minus the radius of the box projected on the normal.
+		const Vec3 halfSize = box.GetHalfSize();
+		const Real radius = halfSize.x * Math::Abs(plane.m_Normal.x) + halfSize.y * Math::Abs(plane.m_Normal.y) + halfSize.z * Math::Abs(plane.m_Normal.z);
+		return Math::Dot(plane.m_Normal, box.GetCenter()) - radius <= plane.m_Offset;
+	}
+
 	bool IntersectionDetector::BoxAndBox(const Box &one, const Box &two)
 	{
 		Vec3 toCenter = two.GetPosition() - one.GetPosition();
@@ -80,6 +88,11 @@ namespace Voxymore::Core
 		return oneProject + twoProject - distance;
 	}
 
+	bool IntersectionDetector::ConvexAndConvex(const PrimitiveCollider& one, const PrimitiveCollider& two)
+	{
+		return GJK::Intersect(one, two);
+	}
+
 	uint32_t CollisionDetector::SphereAndSphere(const Sphere &one, const Sphere &two, CollisionData *data)
 	{
 		VXM_PROFILE_FUNCTION();
@@ -104,7 +117,7 @@ namespace Voxymore::Core
 
 		RigidbodyContact contacts;
 		contacts.contactNormal = normal;
-		contacts.contactPoint = pOne + midline * (Real)0.5;
+		contacts.contactPoint = pOne - midline * (Real)0.5;
 		contacts.penetration = (one.m_Radius + two.m_Radius - size);
 		contacts.SetBodyData(one.m_Body, two.m_Body, data->friction, data->restitution);
 		data->AddContact(contacts);
@@ -190,8 +203,9 @@ namespace Voxymore::Core
 		auto vertices = box.GetVertices();
 		int contactUsed = 0;
 
-		for(auto& vertexPos: vertices)
+		for(uint32_t i = 0; i < vertices.size(); ++i)
 		{
+			const Vec3& vertexPos = vertices[i];
 			Real vertDistance = Math::Dot(vertexPos, plane.m_Normal);
 
 			if(vertDistance <= plane.m_Offset)
@@ -202,6 +216,7 @@ namespace Voxymore::Core
 				contact.contactPoint += vertexPos;
 				contact.contactNormal = plane.m_Normal;
 				contact.penetration = plane.m_Offset - vertDistance;
+				contact.feature = i;
 				contact.SetBodyData(box.m_Body, nullptr, data->friction, data->restitution);
 				data->AddContact(contact);
 				contactUsed++;
@@ -263,6 +278,28 @@ namespace Voxymore::Core
 		return 1;
 	}
 
+	// The manifold is reused while box two moves less than this relative to box one.
+	static constexpr Real s_ManifoldPositionTolerance = 1e-3;
+	static constexpr Real s_ManifoldRotationTolerance = 1e-3;
+
+	/**
+	 * The id of a contact of a box pair: the SAT axis in the high bits, then the incident face and the clipping that produced the point.
+	 */
+	static uint32_t GetBoxFeature(int32_t axis, uint32_t incidentFace, uint32_t tag)
+	{
+		return (static_cast<uint32_t>(axis) << 24) | (incidentFace << 20) | tag;
+	}
+
+	static bool IsSameRelativeTransform(const Mat4& a, const Mat4& b)
+	{
+		if(Math::SqrMagnitude(Vec3(a[3]) - Vec3(b[3])) > s_ManifoldPositionTolerance * s_ManifoldPositionTolerance) return false;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			if(Math::SqrMagnitude(Vec3(a[i]) - Vec3(b[i])) > s_ManifoldRotationTolerance * s_ManifoldRotationTolerance) return false;
+		}
+		return true;
+	}
+
 	Vec3 GetContactPoint(const Vec3& axisOne, const Vec3& axisTwo, const Vec3& ptOnEdgeOne, const Vec3& ptOnEdgeTwo)
 	{
 		VXM_PROFILE_FUNCTION();
@@ -286,7 +323,207 @@ namespace Voxymore::Core
 		return nearestPtOnOne * (Real)0.5 + nearestPtOnTwo * (Real)0.5;
 	}
 
+	namespace
+	{
+		struct ClipVertex
+		{
+			// Position in the space of the reference box.
+			Vec3 position;
+			// The edge of the incident face the vertex lies on.
+			uint32_t edge;
+			uint32_t tag;
+		};
+
+		/**
+		 * @brief Sutherland-Hodgman clipping of the polygon by the plane `sign * position[axis] <= limit`.
+		 */
+		void ClipPolygon(const std::vector<ClipVertex>& input, std::vector<ClipVertex>& output, int32_t axis, Real sign, Real limit, uint32_t plane)
+		{
+			output.clear();
+			if(input.empty()) return;
+
+			for (size_t i = 0; i < input.size(); ++i)
+			{
+				const ClipVertex& p = input[i];
+				const ClipVertex& q = input[(i + 1) % input.size()];
+				const Real dp = sign * p.position[axis] - limit;
+				const Real dq = sign * q.position[axis] - limit;
+
+				if(dp <= 0) output.push_back(p);
+				if((dp <= 0) != (dq <= 0))
+				{
+					const Real t = dp / (dp - dq);
+					const uint32_t edge = p.edge;
+					output.push_back({p.position + (q.position - p.position) * t, edge, 4 + plane * 4 + edge});
+				}
+			}
+		}
+
+		/**
+		 * @brief Keep the 4 points spanning the biggest area, starting with the deepest one.
+		 */
+		void ReduceManifold(std::vector<RigidbodyContact>& contacts)
+		{
+			if(contacts.size() <= BoxManifold::MaxPoints) return;
+
+			std::array<size_t, 4> kept{};
+			kept[0] = 0;
+			for (size_t i = 1; i < contacts.size(); ++i)
+			{
+				if(contacts[i].penetration > contacts[kept[0]].penetration) kept[0] = i;
+			}
+
+			const Vec3 p0 = contacts[kept[0]].contactPoint;
+			Real best = -1;
+			for (size_t i = 0; i < contacts.size(); ++i)
+			{
+				Real d = Math::SqrMagnitude(contacts[i].contactPoint - p0);
+				if(d > best) { best = d; kept[1] = i; }
+			}
+
+			const Vec3 edge = contacts[kept[1]].contactPoint - p0;
+			Vec3 bestCross(0);
+			best = -1;
+			for (size_t i = 0; i < contacts.size(); ++i)
+			{
+				Vec3 cross = Math::Cross(edge, contacts[i].contactPoint - p0);
+				Real area = Math::SqrMagnitude(cross);
+				if(area > best) { best = area; kept[2] = i; bestCross = cross; }
+			}
+
+			// The last point is on the other side of the first edge than the third one.
+			best = -1;
+			kept[3] = kept[0];
+			for (size_t i = 0; i < contacts.size(); ++i)
+			{
+				Real side = -Math::Dot(Math::Cross(edge, contacts[i].contactPoint - p0), bestCross);
+				if(side > best) { best = side; kept[3] = i; }
+			}
+
+			std::vector<RigidbodyContact> reduced;
+			reduced.reserve(4);
+			for (size_t i = 0; i < kept.size(); ++i)
+			{
+				if(std::find(kept.begin(), kept.begin() + i, kept[i]) != kept.begin() + i) continue;
+				reduced.push_back(contacts[kept[i]]);
+			}
+			contacts.swap(reduced);
+		}
+
+		/**
+		 * @brief Compute the contacts of a face of the reference box against the incident box by clipping the incident face.
+		 * @param toCenter The vector from the reference box to the incident box.
+		 * @return The contacts, the normal pointing toward the reference box.
+		 */
+		void FaceContacts(const Box& reference, const Box& incident, int32_t axis, int32_t bestCase, const Vec3& toCenter, std::vector<RigidbodyContact>& contacts)
+		{
+			VXM_PROFILE_FUNCTION();
+			const Real referenceSign = Math::Dot(reference.GetAxis(axis), toCenter) > 0 ? (Real)1 : (Real)-1;
+			// Pointing from the incident box to the reference one.
+			const Vec3 normal = Math::Normalize(reference.GetAxis(axis)) * -referenceSign;
+
+			// The face of the incident box the most facing the reference box.
+			int32_t incidentAxis = 0;
+			Real bestDot = -1;
+			for (int32_t i = 0; i < 3; ++i)
+			{
+				Real dot = Math::Abs(Math::Dot(Math::Normalize(incident.GetAxis(i)), normal));
+				if(dot > bestDot) { bestDot = dot; incidentAxis = i; }
+			}
+			const Real incidentSign = Math::Dot(incident.GetAxis(incidentAxis), normal) > 0 ? (Real)1 : (Real)-1;
+			const uint32_t incidentFace = static_cast<uint32_t>(incidentAxis) * 2 + (incidentSign > 0 ? 1u : 0u);
+
+			const int32_t u = (incidentAxis + 1) % 3;
+			const int32_t v = (incidentAxis + 2) % 3;
+			const std::array<Vec2, 4> corners = {Vec2{1, 1}, Vec2{-1, 1}, Vec2{-1, -1}, Vec2{1, -1}};
+
+			const Mat4 incidentToReference = Math::Inverse(reference.GetMatrix()) * incident.GetMatrix();
+			std::vector<ClipVertex> polygon;
+			polygon.reserve(8);
+			for (uint32_t i = 0; i < 4; ++i)
+			{
+				Vec3 local(0);
+				local[incidentAxis] = incident.m_HalfSize[incidentAxis] * incidentSign;
+				local[u] = incident.m_HalfSize[u] * corners[i].x;
+				local[v] = incident.m_HalfSize[v] * corners[i].y;
+				polygon.push_back({Math::TransformPoint(incidentToReference, local), i, i});
+			}
+
+			// Clip by the 4 side planes of the reference face.
+			std::vector<ClipVertex> clipped;
+			clipped.reserve(8);
+			uint32_t plane = 0;
+			for (int32_t side = 0; side < 3; ++side)
+			{
+				if(side == axis) continue;
+				ClipPolygon(polygon, clipped, side, 1, reference.m_HalfSize[side], plane++);
+				ClipPolygon(clipped, polygon, side, -1, reference.m_HalfSize[side], plane++);
+			}
+
+			Vec3 faceCenter(0);
+			faceCenter[axis] = reference.m_HalfSize[axis] * referenceSign;
+			const Vec3 facePoint = Math::TransformPoint(reference.GetMatrix(), faceCenter);
+
+			contacts.clear();
+			for (const ClipVertex& vertex : polygon)
+			{
+				Vec3 point = Math::TransformPoint(reference.GetMatrix(), vertex.position);
+				Real depth = Math::Dot(point - facePoint, normal);
+				if(depth < 0) continue;
+
+				RigidbodyContact contact;
+				contact.contactPoint = point;
+				contact.contactNormal = normal;
+				contact.penetration = depth;
+				contact.feature = GetBoxFeature(bestCase, incidentFace, vertex.tag);
+				contact.SetBodyData(reference.m_Body, incident.m_Body, 0, 0);
+				contacts.push_back(contact);
+			}
+
+			ReduceManifold(contacts);
+		}
+	}
+
+	void BoxManifold::Store(const Box& one, const std::vector<RigidbodyContact>& contacts, const Mat4& relative, bool swap)
+	{
+		const Mat4 inverse = Math::Inverse(one.GetMatrix());
+		pointCount = static_cast<uint32_t>(Math::Min<size_t>(contacts.size(), MaxPoints));
+		for (uint32_t i = 0; i < pointCount; ++i)
+		{
+			points[i].localPoint = Math::TransformPoint(inverse, contacts[i].contactPoint);
+			points[i].localNormal = Math::TransformDirection(inverse, contacts[i].contactNormal);
+			points[i].penetration = contacts[i].penetration;
+			points[i].feature = contacts[i].feature;
+		}
+		relativeTransform = relative;
+		swapped = swap;
+		separatingAxis = -1;
+	}
+
+	uint32_t BoxManifold::Emit(const Box& one, const Box& two, CollisionData* data) const
+	{
+		const Mat4 matrix = one.GetMatrix();
+		for (uint32_t i = 0; i < pointCount; ++i)
+		{
+			RigidbodyContact contact;
+			contact.contactPoint = Math::TransformPoint(matrix, points[i].localPoint);
+			contact.contactNormal = Math::Normalize(Math::TransformDirection(matrix, points[i].localNormal));
+			contact.penetration = points[i].penetration;
+			contact.feature = points[i].feature;
+			if(swapped) contact.SetBodyData(two.m_Body, one.m_Body, data->friction, data->restitution);
+			else contact.SetBodyData(one.m_Body, two.m_Body, data->friction, data->restitution);
+			data->AddContact(contact);
+		}
+		return pointCount;
+	}
+
 	uint32_t CollisionDetector::BoxAndBox(const Box &one, const Box &two, CollisionData *data)
+	{
+		BoxManifold manifold;
+		return BoxAndBox(one, two, data, manifold);
+	}
+
+	uint32_t CollisionDetector::BoxAndBox(const Box &one, const Box &two, CollisionData *data, BoxManifold& manifold)
 	{
 		VXM_PROFILE_FUNCTION();
 		VXM_CORE_ASSERT(data, "The CollisionData is not valid.");
@@ -295,6 +532,13 @@ namespace Voxymore::Core
 			return 0;
 		}
 
+		// The boxes are placed the same way relative to each other, the contacts are the same in the space of box one.
+		const Mat4 relative = Math::Inverse(one.GetMatrix()) * two.GetMatrix();
+		if(manifold.pointCount > 0 && IsSameRelativeTransform(relative, manifold.relativeTransform))
+		{
+			return manifold.Emit(one, two, data);
+		}
+
 		Real bestOverlap = REAL_MAX;
 		int32_t bestCase = -1;
 
@@ -327,6 +571,17 @@ namespace Voxymore::Core
 						Math::Cross(one.GetAxis(2), two.GetAxis(2)),
 		};
 
+		// The axis that separated the boxes last time is the most likely to still separate them.
+		if(manifold.separatingAxis >= 0)
+		{
+			const Vec3& axe = axis[manifold.separatingAxis];
+			if(Math::SqrMagnitude(axe) >= 0.001 && IntersectionDetector::PenetrationOnAxis(one, two, Math::Normalize(axe), toCenter) < 0)
+			{
+				manifold.pointCount = 0;
+				return 0;
+			}
+		}
+
 		// Finding the best scenario (if any)
 		for (int32_t i = 0; i < 15; ++i)
 		{
@@ -337,6 +592,8 @@ namespace Voxymore::Core
 
 			Real overlap = IntersectionDetector::PenetrationOnAxis(one, two, axe, toCenter);
 			if (overlap < 0) {
+				manifold.separatingAxis = i;
+				manifold.pointCount = 0;
 				return 0;
 			}
 			else if (overlap < bestOverlap) {
@@ -348,60 +605,25 @@ namespace Voxymore::Core
 		VXM_CORE_ASSERT(bestCase >= 0, "No best case found...");
 		if(bestCase < 0) return 0;
 
+		std::vector<RigidbodyContact> contacts;
+		contacts.reserve(8);
+		bool swapped = false;
+
 		if(bestCase < 3) // Face Object one
 		{
-			RigidbodyContact contact;
-
-			Vec3 normal = one.GetAxis(bestCase);
-			if (Math::Dot(one.GetAxis(bestCase), toCenter) > 0)
-			{
-				normal *= (Real)-1.0;
-			}
-
-			// Work out which vertex of box two we're colliding with.
-			Vec3 vertex = two.m_HalfSize;
-			if (Math::Dot(two.GetAxis(0), normal) < 0) vertex.x = -vertex.x;
-			if (Math::Dot(two.GetAxis(1), normal) < 0) vertex.y = -vertex.y;
-			if (Math::Dot(two.GetAxis(2), normal) < 0) vertex.z = -vertex.z;
-
-			// Create the contact data
-			contact.contactNormal = normal;
-			contact.penetration = bestOverlap;
-			contact.contactPoint = Math::TransformPoint(two.GetMatrix(), vertex);
-			contact.SetBodyData(one.m_Body, two.m_Body, data->friction, data->restitution);
-			data->AddContact(contact);
-			return 1;
+			FaceContacts(one, two, bestCase, bestCase, toCenter, contacts);
 		}
 		else if(bestCase < 6) // Face Object two
 		{
-			RigidbodyContact contact;
-
-			Vec3 normal = two.GetAxis(bestCase-3);
-			if (Math::Dot(two.GetAxis(bestCase-3), (toCenter * (Real)-1)) > 0)
-			{
-				normal *= (Real)-1.0;
-			}
-
-			// Work out which vertex of box two we're colliding with.
-			Vec3 vertex = one.m_HalfSize;
-			if (Math::Dot(one.GetAxis(0), normal) < 0) vertex.x = -vertex.x;
-			if (Math::Dot(one.GetAxis(1), normal) < 0) vertex.y = -vertex.y;
-			if (Math::Dot(one.GetAxis(2), normal) < 0) vertex.z = -vertex.z;
-
-			// Create the contact data
-			contact.contactNormal = normal;
-			contact.penetration = bestOverlap;
-			contact.contactPoint = Math::TransformPoint(one.GetMatrix(), vertex);
-			contact.SetBodyData(two.m_Body, one.m_Body, data->friction, data->restitution);
-			data->AddContact(contact);
-			return 1;
+			FaceContacts(two, one, bestCase - 3, bestCase, toCenter * (Real)-1, contacts);
+			swapped = true;
 		}
 		else // Edge vs Edge contact
 		{
 			// We've got an edge-edge contact. Find out which axes
-			bestCase -= 6;
-			int32_t oneAxisIndex = bestCase / 3;
-			int32_t twoAxisIndex = bestCase % 3;
+			int32_t edgeCase = bestCase - 6;
+			int32_t oneAxisIndex = edgeCase / 3;
+			int32_t twoAxisIndex = edgeCase % 3;
 
 			Vec3 oneAxis = one.GetAxis(oneAxisIndex);
 			Vec3 twoAxis = two.GetAxis(twoAxisIndex);
@@ -421,12 +643,417 @@ namespace Voxymore::Core
 			}
 
 			RigidbodyContact contact;
-			contact.contactPoint = GetContactPoint(oneAxis, twoAxis, ptOnEdgeOne, ptOnEdgeTwo);
+			contact.contactPoint = GetContactPoint(oneAxis, twoAxis, Math::TransformPoint(one.GetMatrix(), ptOnEdgeOne), Math::TransformPoint(two.GetMatrix(), ptOnEdgeTwo));
 			contact.contactNormal = axe;
 			contact.penetration = bestOverlap;
-			contact.SetBodyData(two.m_Body, one.m_Body, data->friction, data->restitution);
+			contact.feature = GetBoxFeature(bestCase, 0, 0);
+			contacts.push_back(contact);
+		}
+
+		// The clipping can lose every point on degenerated configurations, fall back on the deepest vertex.
+		if(contacts.empty())
+		{
+			const Box& reference = bestCase < 3 ? one : two;
+			const Box& incident = bestCase < 3 ? two : one;
+			const int32_t referenceAxis = bestCase < 3 ? bestCase : bestCase - 3;
+			Vec3 normal = Math::Normalize(reference.GetAxis(referenceAxis));
+			if (Math::Dot(normal, incident.GetPosition() - reference.GetPosition()) > 0) normal *= (Real)-1.0;
+
+			Vec3 vertex = incident.m_HalfSize;
+			if (Math::Dot(incident.GetAxis(0), normal) < 0) vertex.x = -vertex.x;
+			if (Math::Dot(incident.GetAxis(1), normal) < 0) vertex.y = -vertex.y;
+			if (Math::Dot(incident.GetAxis(2), normal) < 0) vertex.z = -vertex.z;
+
+			RigidbodyContact contact;
+			contact.contactNormal = normal;
+			contact.penetration = bestOverlap;
+			contact.contactPoint = Math::TransformPoint(incident.GetMatrix(), vertex);
+			contact.feature = GetBoxFeature(bestCase, 0, 0);
+			contacts.push_back(contact);
+		}
+
+		manifold.Store(one, contacts, relative, swapped);
+		return manifold.Emit(one, two, data);
+	}
+
+	// The reference face is only taken from the second collider when it is clearly better aligned, so the manifold doesn't flip between frames.
+	static constexpr Real s_ReferenceRelativeTolerance = 0.98;
+	static constexpr Real s_ReferenceAbsoluteTolerance = 1e-3;
+	// Below this alignment with the penetration normal, the contact is on an edge and the faces are not clipped.
+	static constexpr Real s_FaceContactCosine = 0.7;
+
+	namespace
+	{
+		/**
+		 * The id of a contact of a convex pair: the reference face, the incident face and the clipping that produced the point.
+		 */
+		uint32_t GetConvexFeature(bool flip, uint32_t referenceFace, uint32_t incidentFace, uint32_t tag)
+		{
+			return (flip ? 1u << 31 : 0u) | ((referenceFace & 0x7F) << 24) | ((incidentFace & 0xFF) << 16) | (tag & 0xFFFF);
+		}
+
+		/**
+		 * @brief Sutherland-Hodgman clipping of the polygon by the plane `dot(normal, position) <= offset`.
+		 */
+		void ClipPolygon(const std::vector<ClipVertex>& input, std::vector<ClipVertex>& output, const Vec3& normal, Real offset, uint32_t plane)
+		{
+			output.clear();
+			if(input.empty()) return;
+
+			for (size_t i = 0; i < input.size(); ++i)
+			{
+				const ClipVertex& p = input[i];
+				const ClipVertex& q = input[(i + 1) % input.size()];
+				const Real dp = Math::Dot(normal, p.position) - offset;
+				const Real dq = Math::Dot(normal, q.position) - offset;
+
+				if(dp <= 0) output.push_back(p);
+				if((dp <= 0) != (dq <= 0))
+				{
+					const Real t = dp / (dp - dq);
+					output.push_back({p.position + (q.position - p.position) * t, p.edge, 0x8000 | ((plane & 0x7F) << 8) | (p.edge & 0xFF)});
+				}
+			}
+		}
+
+		/**
+		 * @brief Compute the contacts of the reference face against the incident face by clipping the incident face.
+		 * @return The contacts, the normal pointing away from the reference face.
+		 */
+		void FaceContacts(const SupportFace& reference, const SupportFace& incident, std::vector<RigidbodyContact>& contacts)
+		{
+			VXM_PROFILE_FUNCTION();
+			thread_local std::vector<ClipVertex> polygon;
+			thread_local std::vector<ClipVertex> clipped;
+			polygon.clear();
+			for (uint32_t i = 0; i < incident.points.size(); ++i)
+			{
+				polygon.push_back({incident.points[i], i, i});
+			}
+
+			Vec3 center(0);
+			for (const Vec3& point : reference.points) center += point;
+			center /= static_cast<Real>(reference.points.size());
+
+			// Clip by the planes going through the edges of the reference face, each one facing away from the face.
+			for (uint32_t i = 0; i < reference.points.size() && !polygon.empty(); ++i)
+			{
+				const Vec3& a = reference.points[i];
+				const Vec3& b = reference.points[(i + 1) % reference.points.size()];
+				Vec3 side = Math::Cross(b - a, reference.normal);
+				if(Math::SqrMagnitude(side) <= REAL_EPSILON) continue;
+				side = Math::Normalize(side);
+				if(Math::Dot(side, center - a) > 0) side = -side;
+
+				ClipPolygon(polygon, clipped, side, Math::Dot(side, a), i);
+				polygon.swap(clipped);
+			}
+
+			contacts.clear();
+			const Real offset = Math::Dot(reference.normal, reference.points[0]);
+			for (const ClipVertex& vertex : polygon)
+			{
+				const Real depth = offset - Math::Dot(reference.normal, vertex.position);
+				if(depth < 0) continue;
+
+				RigidbodyContact contact;
+				contact.contactPoint = vertex.position;
+				contact.contactNormal = -reference.normal;
+				contact.penetration = depth;
+				contact.feature = vertex.tag;
+				contacts.push_back(contact);
+			}
+
+			ReduceManifold(contacts);
+		}
+	}
+
+	uint32_t CollisionDetector::ConvexAndConvex(const PrimitiveCollider& one, const PrimitiveCollider& two, CollisionData* data)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(data, "The CollisionData is not valid.");
+		if(!data)
+		{
+			return 0;
+		}
+
+		ConvexPenetration penetration;
+		if(!GJK::Penetration(one, two, penetration) || penetration.depth <= 0)
+		{
+			return 0;
+		}
+
+		// A single contact can't hold a resting shape, the faces facing each other are clipped to get up to 4 of them.
+		thread_local SupportFace faceOne;
+		thread_local SupportFace faceTwo;
+		thread_local std::vector<RigidbodyContact> contacts;
+		if(one.GetSupportFace(penetration.normal, faceOne) && two.GetSupportFace(-penetration.normal, faceTwo))
+		{
+			const Real alignOne = Math::Dot(faceOne.normal, penetration.normal);
+			const Real alignTwo = -Math::Dot(faceTwo.normal, penetration.normal);
+			const bool flip = alignTwo > alignOne * s_ReferenceRelativeTolerance + s_ReferenceAbsoluteTolerance;
+			const PrimitiveCollider& incident = flip ? one : two;
+			SupportFace& reference = flip ? faceTwo : faceOne;
+			SupportFace& incidentFace = flip ? faceOne : faceTwo;
+
+			if(Math::Max(alignOne, alignTwo) >= s_FaceContactCosine && incident.GetSupportFace(-reference.normal, incidentFace))
+			{
+				FaceContacts(reference, incidentFace, contacts);
+				for (RigidbodyContact& contact : contacts)
+				{
+					// The normal must point toward the first collider.
+					if(flip) contact.contactNormal = -contact.contactNormal;
+					contact.feature = GetConvexFeature(flip, reference.index, incidentFace.index, contact.feature);
+					contact.SetBodyData(one.m_Body, two.m_Body, data->friction, data->restitution);
+					data->AddContact(contact);
+				}
+				if(!contacts.empty()) return static_cast<uint32_t>(contacts.size());
+			}
+		}
+
+		// The EPA normal pushes the second shape away, the contact normal points toward the first one.
+		RigidbodyContact contact;
+		contact.contactNormal = -penetration.normal;
+		contact.contactPoint = (penetration.pointOne + penetration.pointTwo) * (Real)0.5;
+		contact.penetration = penetration.depth;
+		contact.SetBodyData(one.m_Body, two.m_Body, data->friction, data->restitution);
+		data->AddContact(contact);
+
+		return 1;
+	}
+
+	uint32_t CollisionDetector::ConvexHullAndHalfSpace(const ConvexHull& hull, const Plane& plane, CollisionData* data)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(data, "The CollisionData is not valid.");
+		if(!data)
+		{
+			return 0;
+		}
+
+		// The deepest point of the hull is in front of the plane.
+		if(Math::Dot(hull.Support(-plane.m_Normal), plane.m_Normal) > plane.m_Offset)
+		{
+			return 0;
+		}
+
+		// A hull resting on a face has every vertex of the face below the plane, only the 4 spanning the biggest area are kept.
+		thread_local std::vector<RigidbodyContact> contacts;
+		contacts.clear();
+
+		const Mat4 matrix = hull.GetMatrix();
+		const std::vector<Vec3>& vertices = hull.GetLocalVertices();
+		for(uint32_t i = 0; i < vertices.size(); ++i)
+		{
+			const Vec3 vertexPos = Math::TransformPoint(matrix, vertices[i]);
+			Real vertDistance = Math::Dot(vertexPos, plane.m_Normal);
+
+			if(vertDistance <= plane.m_Offset)
+			{
+				RigidbodyContact contact;
+				contact.contactPoint = plane.m_Normal;
+				contact.contactPoint *= (vertDistance -plane.m_Offset);
+				contact.contactPoint += vertexPos;
+				contact.contactNormal = plane.m_Normal;
+				contact.penetration = plane.m_Offset - vertDistance;
+				contact.feature = i;
+				contact.SetBodyData(hull.m_Body, nullptr, data->friction, data->restitution);
+				contacts.push_back(contact);
+			}
+		}
+
+		ReduceManifold(contacts);
+		for (const RigidbodyContact& contact : contacts)
+		{
 			data->AddContact(contact);
-			return 1;
 		}
+
+		return static_cast<uint32_t>(contacts.size());
+	}
+
+	uint32_t CollisionDetector::ConvexHullAndSphere(const ConvexHull& hull, const Sphere& sphere, CollisionData* data)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(data, "The CollisionData is not valid.");
+		if(!data)
+		{
+			return 0;
+		}
+
+		const Vec3 sphereCenter = sphere.GetPosition();
+		const ConvexDistance distance = GJK::Distance(sphereCenter, hull);
+
+		RigidbodyContact contact;
+		if(!distance.overlap)
+		{
+			if(distance.distance >= sphere.m_Radius || distance.distance <= REAL_EPSILON) return 0;
+			contact.contactPoint = distance.pointTwo;
+			contact.contactNormal = (distance.pointTwo - sphereCenter) / distance.distance;
+			contact.penetration = sphere.m_Radius - distance.distance;
+		}
+		else
+		{
+			// The center is inside the hull, the EPA finds the closest face.
+			ConvexPenetration penetration;
+			if(!GJK::Penetration(sphereCenter, hull, penetration)) return 0;
+			contact.contactPoint = penetration.pointTwo;
+			contact.contactNormal = penetration.normal;
+			contact.penetration = sphere.m_Radius + penetration.depth;
+		}
+		contact.SetBodyData(hull.m_Body, sphere.m_Body, data->friction, data->restitution);
+		data->AddContact(contact);
+
+		return 1;
+	}
+
+	// Distance under which the conservative advancement considers the shapes touching.
+	static constexpr Real s_AdvancementTolerance = 1e-3;
+	static constexpr uint32_t s_AdvancementMaxIterations = 32;
+
+	bool ContinuousCollisionDetector::SweptSphereAndSphere(const Vec3& center, Real radius, const Vec3& displacement, const Sphere& sphere, TimeOfImpact& toi)
+	{
+		VXM_PROFILE_FUNCTION();
+		// Solve |center + t * displacement - sphereCenter| = radius + sphereRadius for the smallest t.
+		const Vec3 toCenter = center - sphere.GetPosition();
+		const Real radiusSum = radius + sphere.m_Radius;
+		const Real c = Math::SqrMagnitude(toCenter) - radiusSum * radiusSum;
+		if(c <= 0) return false;
+
+		const Real a = Math::SqrMagnitude(displacement);
+		const Real b = Math::Dot(toCenter, displacement);
+		// Not moving or moving away.
+		if(a <= REAL_EPSILON || b >= 0) return false;
+
+		const Real discriminant = b * b - a * c;
+		if(discriminant < 0) return false;
+
+		const Real t = (-b - Math::Sqrt(discriminant)) / a;
+		if(t < 0 || t >= toi.time) return false;
+
+		toi.time = t;
+		toi.normal = Math::Normalize(toCenter + displacement * t);
+		toi.point = sphere.GetPosition() + toi.normal * sphere.m_Radius;
+		return true;
+	}
+
+	bool ContinuousCollisionDetector::SweptSphereAndHalfSpace(const Vec3& center, Real radius, const Vec3& displacement, const Plane& plane, TimeOfImpact& toi)
+	{
+		VXM_PROFILE_FUNCTION();
+		const Real distance = Math::Dot(plane.m_Normal, center) - radius - plane.m_Offset;
+		if(distance <= 0) return false;
+
+		const Real approach = Math::Dot(plane.m_Normal, displacement);
+		if(approach >= 0) return false;
+
+		const Real t = distance / -approach;
+		if(t >= toi.time) return false;
+
+		toi.time = t;
+		toi.normal = plane.m_Normal;
+		toi.point = center + displacement * t - plane.m_Normal * radius;
+		return true;
+	}
+
+	bool ContinuousCollisionDetector::SweptSphereAndBox(const Vec3& center, Real radius, const Vec3& displacement, const Box& box, TimeOfImpact& toi)
+	{
+		VXM_PROFILE_FUNCTION();
+		const Real speed = Math::Magnitude(displacement);
+		if(speed <= REAL_EPSILON) return false;
+
+		const Mat4 inverse = Math::Inverse(box.GetMatrix());
+		Real t = 0;
+		for (uint32_t i = 0; i < s_AdvancementMaxIterations; ++i)
+		{
+			const Vec3 position = center + displacement * t;
+			const Vec3 local = Math::TransformPoint(inverse, position);
+			const Vec3 closestLocal = Math::Clamp(local, -box.m_HalfSize, box.m_HalfSize);
+			const Vec3 closest = Math::TransformPoint(box.GetMatrix(), closestLocal);
+			const Vec3 toSphere = position - closest;
+			const Real distance = Math::Magnitude(toSphere) - radius;
+
+			if(distance <= s_AdvancementTolerance)
+			{
+				// Overlapping from the start.
+				if(t == 0) return false;
+				if(t >= toi.time) return false;
+
+				toi.time = t;
+				toi.normal = Math::Magnitude(toSphere) > REAL_EPSILON ? Math::Normalize(toSphere) : Math::Normalize(displacement) * (Real)-1;
+				toi.point = closest;
+				return true;
+			}
+
+			// The sphere cannot get closer to the box than the distance it travels.
+			t += distance / speed;
+			if(t >= toi.time) return false;
+		}
+		return false;
+	}
+
+	bool ContinuousCollisionDetector::SweptSphereAndConvexHull(const Vec3& center, Real radius, const Vec3& displacement, const ConvexHull& hull, TimeOfImpact& toi)
+	{
+		VXM_PROFILE_FUNCTION();
+		const Real speed = Math::Magnitude(displacement);
+		if(speed <= REAL_EPSILON) return false;
+
+		Real t = 0;
+		for (uint32_t i = 0; i < s_AdvancementMaxIterations; ++i)
+		{
+			const Vec3 position = center + displacement * t;
+			const ConvexDistance closest = GJK::Distance(position, hull);
+			const Real distance = closest.overlap ? -radius : closest.distance - radius;
+
+			if(distance <= s_AdvancementTolerance)
+			{
+				// Overlapping from the start.
+				if(t == 0) return false;
+				if(t >= toi.time) return false;
+
+				toi.time = t;
+				toi.normal = closest.distance > REAL_EPSILON ? (position - closest.pointTwo) / closest.distance : Math::Normalize(displacement) * (Real)-1;
+				toi.point = closest.pointTwo;
+				return true;
+			}
+
+			// The sphere cannot get closer to the hull than the distance it travels.
+			t += distance / speed;
+			if(t >= toi.time) return false;
+		}
+		return false;
+	}
+
+	Real ContinuousCollisionDetector::GetInnerRadius(const Sphere& sphere)
+	{
+		return sphere.m_Radius;
+	}
+
+	Real ContinuousCollisionDetector::GetInnerRadius(const Box& box)
+	{
+		Real radius = REAL_MAX;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			radius = Math::Min(radius, box.m_HalfSize[i] * Math::Magnitude(box.GetAxis(i)));
+		}
+		return radius;
+	}
+
+	Real ContinuousCollisionDetector::GetInnerRadius(const Plane& plane)
+	{
+		return 0;
+	}
+
+	Real ContinuousCollisionDetector::GetInnerRadius(const ConvexHull& hull)
+	{
+		return hull.GetInnerRadius();
+	}
+
+	Vec3 ContinuousCollisionDetector::GetInnerCenter(const PrimitiveCollider& collider)
+	{
+		return collider.GetPosition();
+	}
+
+	Vec3 ContinuousCollisionDetector::GetInnerCenter(const ConvexHull& hull)
+	{
+		return hull.GetInnerCenter();
 	}
 } // namespace Voxymore::Core
@@ -0,0 +1,452 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/Collisions/DynamicBVH.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace Voxymore::Core
+{
+	DynamicBVH::DynamicBVH(Real margin, Real displacementMultiplier) : BroadPhase(margin, displacementMultiplier)
+	{
+	}
+
+	uint32_t DynamicBVH::CreateProxy(const BoundingBox &box, Rigidbody *body, Entity entity, const CollisionFilter& filter, bool isStatic)
+	{
+		VXM_PROFILE_FUNCTION();
+		uint32_t proxy = m_Nodes.Allocate();
+		Node& node = m_Nodes[proxy];
+		node.box = ComputeFatBoundingBox(box, Vec3(0));
+		node.body = body;
+		node.entity = entity;
+		node.filter = filter;
+		node.isStatic = isStatic;
+		node.height = 0;
+		node.moved = true;
+
+		InsertLeaf(proxy);
+		m_MoveBuffer.push_back(proxy);
+		++m_ProxyCount;
+		return proxy;
+	}
+
+	void DynamicBVH::DestroyProxy(uint32_t proxy)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(m_Nodes.IsValid(proxy) && m_Nodes[proxy].height == 0, "The proxy {0} is not a leaf of the tree.", proxy);
+
+		// The id might be reused by the next proxy, so the pairs have to be removed right now.
+		std::erase_if(m_Pairs, [proxy](uint64_t pair) { return GetFirst(pair) == proxy || GetSecond(pair) == proxy; });
+		std::erase(m_MoveBuffer, proxy);
+
+		RemoveLeaf(proxy);
+		m_Nodes.Free(proxy);
+		--m_ProxyCount;
+	}
+
+	bool DynamicBVH::MoveProxy(uint32_t proxy, const BoundingBox &box, const Vec3& displacement)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(m_Nodes.IsValid(proxy) && m_Nodes[proxy].height == 0, "The proxy {0} is not a leaf of the tree.", proxy);
+
+		if(m_Nodes[proxy].box.Contains(box))
+		{
+			return false;
+		}
+
+		RemoveLeaf(proxy);
+
+		Node& node = m_Nodes[proxy];
+		node.box = ComputeFatBoundingBox(box, displacement);
+
+		InsertLeaf(proxy);
+
+		if(!m_Nodes[proxy].moved)
+		{
+			m_Nodes[proxy].moved = true;
+			m_MoveBuffer.push_back(proxy);
+		}
+		return true;
+	}
+
+	void DynamicBVH::SetProxyBody(uint32_t proxy, Rigidbody *body)
+	{
+		VXM_CORE_ASSERT(m_Nodes.IsValid(proxy) && m_Nodes[proxy].height == 0, "The proxy {0} is not a leaf of the tree.", proxy);
+		m_Nodes[proxy].body = body;
+	}
+
+	void DynamicBVH::SetProxyFilter(uint32_t proxy, const CollisionFilter& filter)
+	{
+		VXM_CORE_ASSERT(m_Nodes.IsValid(proxy) && m_Nodes[proxy].height == 0, "The proxy {0} is not a leaf of the tree.", proxy);
+		Node& node = m_Nodes[proxy];
+		if(node.filter == filter) return;
+		node.filter = filter;
+
+		// The persistent pairs of the proxy might not be valid anymore, query it again.
+		std::erase_if(m_Pairs, [proxy](uint64_t pair) { return GetFirst(pair) == proxy || GetSecond(pair) == proxy; });
+		if(!node.moved)
+		{
+			node.moved = true;
+			m_MoveBuffer.push_back(proxy);
+		}
+	}
+
+	void DynamicBVH::SetProxyStatic(uint32_t proxy, bool isStatic)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(m_Nodes.IsValid(proxy) && m_Nodes[proxy].height == 0, "The proxy {0} is not a leaf of the tree.", proxy);
+		if(m_Nodes[proxy].isStatic == isStatic) return;
+
+		RemoveLeaf(proxy);
+		m_Nodes[proxy].isStatic = isStatic;
+		InsertLeaf(proxy);
+
+		std::erase_if(m_Pairs, [proxy](uint64_t pair) { return GetFirst(pair) == proxy || GetSecond(pair) == proxy; });
+		if(!m_Nodes[proxy].moved)
+		{
+			m_Nodes[proxy].moved = true;
+			m_MoveBuffer.push_back(proxy);
+		}
+	}
+
+	const BoundingBox& DynamicBVH::GetFatBoundingBox(uint32_t proxy) const
+	{
+		VXM_CORE_ASSERT(m_Nodes.IsValid(proxy) && m_Nodes[proxy].height == 0, "The proxy {0} is not a leaf of the tree.", proxy);
+		return m_Nodes[proxy].box;
+	}
+
+	int32_t DynamicBVH::GetHeight() const
+	{
+		int32_t height = 0;
+		if(m_Root != NullNode) height = m_Nodes[m_Root].height;
+		if(m_StaticRoot != NullNode) height = Math::Max(height, m_Nodes[m_StaticRoot].height);
+		return height;
+	}
+
+	uint32_t DynamicBVH::GetPotentialContacts(std::vector<PotentialContact> &contacts)
+	{
+		VXM_PROFILE_FUNCTION();
+		UpdatePairs();
+
+		contacts.reserve(contacts.size() + m_Pairs.size());
+		for (uint64_t pair : m_Pairs)
+		{
+			const Node& one = m_Nodes[GetFirst(pair)];
+			const Node& two = m_Nodes[GetSecond(pair)];
+			contacts.push_back({{std::pair<Rigidbody*, Entity>{one.body, one.entity}, std::pair<Rigidbody*, Entity>{two.body, two.entity}}, one.filter.isTrigger || two.filter.isTrigger});
+		}
+		return static_cast<uint32_t>(m_Pairs.size());
+	}
+
+	uint32_t DynamicBVH::QueryProxies(const BoundingBox& box, std::vector<std::pair<Rigidbody*, Entity>>& bodies)
+	{
+		VXM_PROFILE_FUNCTION();
+		const size_t count = bodies.size();
+		auto add = [this, &bodies](uint32_t leaf) { bodies.emplace_back(m_Nodes[leaf].body, m_Nodes[leaf].entity); };
+		Query(m_Root, box, add);
+		Query(m_StaticRoot, box, add);
+		return static_cast<uint32_t>(bodies.size() - count);
+	}
+
+	void DynamicBVH::Clear()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Nodes.Clear();
+		m_Pairs.clear();
+		m_NewPairs.clear();
+		m_MoveBuffer.clear();
+		m_Root = NullNode;
+		m_StaticRoot = NullNode;
+		m_ProxyCount = 0;
+	}
+
+	void DynamicBVH::UpdatePairs()
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_MoveBuffer.empty()) return;
+
+		// Remove the pairs that got separated.
+		std::erase_if(m_Pairs, [this](uint64_t pair) {
+			const Node& one = m_Nodes[GetFirst(pair)];
+			const Node& two = m_Nodes[GetSecond(pair)];
+			return (one.moved || two.moved) && !one.box.Overlaps(two.box);
+		});
+
+		// Query the trees for each moved proxy, a static proxy only looks for the dynamic ones.
+		m_NewPairs.clear();
+		for (uint32_t proxy : m_MoveBuffer)
+		{
+			auto addPair = [this, proxy](uint32_t other) {
+				if(other == proxy) return;
+				// Both proxies moved, the pair will be created by the one with the lowest id.
+				if(m_Nodes[other].moved && other < proxy) return;
+				if(!m_Nodes[proxy].filter.ShouldCollide(m_Nodes[other].filter)) return;
+				m_NewPairs.push_back(MakePair(proxy, other));
+			};
+			const BoundingBox box = m_Nodes[proxy].box;
+			Query(m_Root, box, addPair);
+			if(!m_Nodes[proxy].isStatic) Query(m_StaticRoot, box, addPair);
+		}
+
+		std::sort(m_NewPairs.begin(), m_NewPairs.end());
+		m_NewPairs.erase(std::unique(m_NewPairs.begin(), m_NewPairs.end()), m_NewPairs.end());
+
+		// Both vector are sorted, the union keep the pairs sorted, which keeps the order of the contacts deterministic.
+		std::vector<uint64_t> pairs;
+		pairs.reserve(m_Pairs.size() + m_NewPairs.size());
+		std::set_union(m_Pairs.begin(), m_Pairs.end(), m_NewPairs.begin(), m_NewPairs.end(), std::back_inserter(pairs));
+		m_Pairs.swap(pairs);
+
+		for (uint32_t proxy : m_MoveBuffer)
+		{
+			m_Nodes[proxy].moved = false;
+		}
+		m_MoveBuffer.clear();
+	}
+
+	void DynamicBVH::Refit(uint32_t index)
+	{
+		Node& node = m_Nodes[index];
+		const Node& one = m_Nodes[node.children[0]];
+		const Node& two = m_Nodes[node.children[1]];
+		node.box = BoundingBox(one.box, two.box);
+		node.height = 1 + Math::Max(one.height, two.height);
+	}
+
+	void DynamicBVH::InsertLeaf(uint32_t leaf)
+	{
+		VXM_PROFILE_FUNCTION();
+		const bool isStatic = m_Nodes[leaf].isStatic;
+		uint32_t& root = GetRoot(isStatic);
+		if(root == NullNode)
+		{
+			root = leaf;
+			m_Nodes[leaf].parent = NullNode;
+			return;
+		}
+
+		// Find the best sibling using the surface area heuristic.
+		const BoundingBox leafBox = m_Nodes[leaf].box;
+		uint32_t index = root;
+		while(!m_Nodes[index].IsLeaf())
+		{
+			const Node& node = m_Nodes[index];
+			Real area = node.box.GetSurfaceArea();
+			Real combinedArea = BoundingBox(node.box, leafBox).GetSurfaceArea();
+
+			// Cost of creating a new parent for this node and the leaf.
+			Real cost = (Real)2 * combinedArea;
+			// Minimum cost of pushing the leaf further down the tree.
+			Real inheritanceCost = (Real)2 * (combinedArea - area);
+
+			std::array<Real, 2> childCosts{};
+			for (int i = 0; i < 2; ++i)
+			{
+				const Node& child = m_Nodes[node.children[i]];
+				Real childArea = BoundingBox(leafBox, child.box).GetSurfaceArea();
+				if(!child.IsLeaf()) childArea -= child.box.GetSurfaceArea();
+				childCosts[i] = childArea + inheritanceCost;
+			}
+
+			if(cost < childCosts[0] && cost < childCosts[1]) break;
+
+			index = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+		}
+
+		const uint32_t sibling = index;
+		const uint32_t oldParent = m_Nodes[sibling].parent;
+		const uint32_t newParent = m_Nodes.Allocate();
+		{
+			Node& parent = m_Nodes[newParent];
+			parent.parent = oldParent;
+			parent.box = BoundingBox(leafBox, m_Nodes[sibling].box);
+			parent.height = m_Nodes[sibling].height + 1;
+			parent.children = {sibling, leaf};
+			parent.isStatic = isStatic;
+		}
+
+		if(oldParent != NullNode)
+		{
+			Node& old = m_Nodes[oldParent];
+			if(old.children[0] == sibling) old.children[0] = newParent;
+			else old.children[1] = newParent;
+		}
+		else
+		{
+			root = newParent;
+		}
+		m_Nodes[sibling].parent = newParent;
+		m_Nodes[leaf].parent = newParent;
+
+		// Walk back up the tree fixing heights and boxes.
+		index = m_Nodes[leaf].parent;
+		while(index != NullNode)
+		{
+			index = Balance(index);
+			Refit(index);
+			index = m_Nodes[index].parent;
+		}
+	}
+
+	void DynamicBVH::RemoveLeaf(uint32_t leaf)
+	{
+		VXM_PROFILE_FUNCTION();
+		uint32_t& root = GetRoot(m_Nodes[leaf].isStatic);
+		if(leaf == root)
+		{
+			root = NullNode;
+			return;
+		}
+
+		const uint32_t parent = m_Nodes[leaf].parent;
+		const uint32_t grandParent = m_Nodes[parent].parent;
+		const uint32_t sibling = m_Nodes[parent].children[0] == leaf ? m_Nodes[parent].children[1] : m_Nodes[parent].children[0];
+
+		m_Nodes[leaf].parent = NullNode;
+
+		if(grandParent != NullNode)
+		{
+			// Destroy the parent and connect the sibling to the grand parent.
+			Node& grand = m_Nodes[grandParent];
+			if(grand.children[0] == parent) grand.children[0] = sibling;
+			else grand.children[1] = sibling;
+			m_Nodes[sibling].parent = grandParent;
+			m_Nodes.Free(parent);
+
+			uint32_t index = grandParent;
+			while(index != NullNode)
+			{
+				index = Balance(index);
+				Refit(index);
+				index = m_Nodes[index].parent;
+			}
+		}
+		else
+		{
+			root = sibling;
+			m_Nodes[sibling].parent = NullNode;
+			m_Nodes.Free(parent);
+		}
+	}
+
+	uint32_t DynamicBVH::Balance(uint32_t iA)
+	{
+		VXM_PROFILE_FUNCTION();
+		Node& A = m_Nodes[iA];
+		if(A.IsLeaf() || A.height < 2)
+		{
+			return iA;
+		}
+
+		const uint32_t iB = A.children[0];
+		const uint32_t iC = A.children[1];
+		Node& B = m_Nodes[iB];
+		Node& C = m_Nodes[iC];
+
+		const int32_t balance = C.height - B.height;
+
+		// Rotate C up
+		if(balance > 1)
+		{
+			const uint32_t iF = C.children[0];
+			const uint32_t iG = C.children[1];
+			Node& F = m_Nodes[iF];
+			Node& G = m_Nodes[iG];
+
+			// Swap A and C
+			C.children[0] = iA;
+			C.parent = A.parent;
+			A.parent = iC;
+
+			// A's old parent should point to C
+			if(C.parent != NullNode)
+			{
+				Node& parent = m_Nodes[C.parent];
+				if(parent.children[0] == iA) parent.children[0] = iC;
+				else parent.children[1] = iC;
+			}
+			else
+			{
+				GetRoot(A.isStatic) = iC;
+			}
+
+			// Rotate
+			if(F.height > G.height)
+			{
+				C.children[1] = iF;
+				A.children[1] = iG;
+				G.parent = iA;
+				A.box = BoundingBox(B.box, G.box);
+				C.box = BoundingBox(A.box, F.box);
+				A.height = 1 + Math::Max(B.height, G.height);
+				C.height = 1 + Math::Max(A.height, F.height);
+			}
+			else
+			{
+				C.children[1] = iG;
+				A.children[1] = iF;
+				F.parent = iA;
+				A.box = BoundingBox(B.box, F.box);
+				C.box = BoundingBox(A.box, G.box);
+				A.height = 1 + Math::Max(B.height, F.height);
+				C.height = 1 + Math::Max(A.height, G.height);
+			}
+
+			return iC;
+		}
+
+		// Rotate B up
+		if(balance < -1)
+		{
+			const uint32_t iD = B.children[0];
+			const uint32_t iE = B.children[1];
+			Node& D = m_Nodes[iD];
+			Node& E = m_Nodes[iE];
+
+			// Swap A and B
+			B.children[0] = iA;
+			B.parent = A.parent;
+			A.parent = iB;
+
+			// A's old parent should point to B
+			if(B.parent != NullNode)
+			{
+				Node& parent = m_Nodes[B.parent];
+				if(parent.children[0] == iA) parent.children[0] = iB;
+				else parent.children[1] = iB;
+			}
+			else
+			{
+				GetRoot(A.isStatic) = iB;
+			}
+
+			// Rotate
+			if(D.height > E.height)
+			{
+				B.children[1] = iD;
+				A.children[0] = iE;
+				E.parent = iA;
+				A.box = BoundingBox(C.box, E.box);
+				B.box = BoundingBox(A.box, D.box);
+				A.height = 1 + Math::Max(C.height, E.height);
+				B.height = 1 + Math::Max(A.height, D.height);
+			}
+			else
+			{
+				B.children[1] = iE;
+				A.children[0] = iD;
+				D.parent = iA;
+				A.box = BoundingBox(C.box, D.box);
+				B.box = BoundingBox(A.box, E.box);
+				A.height = 1 + Math::Max(C.height, D.height);
+				B.height = 1 + Math::Max(A.height, E.height);
+			}
+
+			return iB;
+		}
+
+		return iA;
+	}
+} // namespace Voxymore::Core
+
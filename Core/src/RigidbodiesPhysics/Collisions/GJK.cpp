@@ -0,0 +1,525 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Core/Core.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/GJK.hpp"
+#include <array>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace Voxymore::Core
+{
+	namespace
+	{
+		constexpr uint32_t s_GJKMaxIterations = 64;
+		constexpr uint32_t s_EPAMaxIterations = 64;
+		// Below this distance the shapes are considered touching.
+		constexpr Real s_GJKTolerance = (Real)1e-5;
+		// The search stops when the next support point doesn't bring the simplex closer to the origin by this fraction.
+		constexpr Real s_GJKRelativeTolerance = (Real)1e-4;
+		// The search stops when the next support point doesn't push the closest face further than this distance.
+		constexpr Real s_EPATolerance = (Real)1e-4;
+
+		struct SupportPoint
+		{
+			// point = one - two
+			Vec3 point = Vec3(0);
+			Vec3 one = Vec3(0);
+			Vec3 two = Vec3(0);
+		};
+
+		/**
+		 * The Minkowski difference of the shapes, the first one can be a single point.
+		 */
+		struct MinkowskiDifference
+		{
+			const PrimitiveCollider* one;
+			Vec3 point;
+			const PrimitiveCollider& two;
+
+			[[nodiscard]] SupportPoint Support(const Vec3& direction) const
+			{
+				SupportPoint support;
+				support.one = one ? one->Support(direction) : point;
+				support.two = two.Support(-direction);
+				support.point = support.one - support.two;
+				return support;
+			}
+
+			[[nodiscard]] Vec3 GetInitialDirection() const
+			{
+				const Vec3 direction = two.GetPosition() - (one ? one->GetPosition() : point);
+				return Math::SqrMagnitude(direction) > REAL_EPSILON ? direction : Vec3(1, 0, 0);
+			}
+		};
+
+		/**
+		 * The simplex of the GJK and the barycentric coordinates of its point closest to the origin.
+		 */
+		struct Simplex
+		{
+			std::array<SupportPoint, 4> points;
+			std::array<Real, 4> weights = {1, 0, 0, 0};
+			uint32_t size = 0;
+
+			void Keep(std::initializer_list<uint32_t> indices, std::initializer_list<Real> barycentric)
+			{
+				Simplex result;
+				auto weight = barycentric.begin();
+				for (uint32_t index : indices)
+				{
+					result.points[result.size] = points[index];
+					result.weights[result.size] = *weight++;
+					++result.size;
+				}
+				*this = result;
+			}
+
+			[[nodiscard]] Vec3 GetPointOne() const
+			{
+				Vec3 result(0);
+				for (uint32_t i = 0; i < size; ++i) result += points[i].one * weights[i];
+				return result;
+			}
+
+			[[nodiscard]] Vec3 GetPointTwo() const
+			{
+				Vec3 result(0);
+				for (uint32_t i = 0; i < size; ++i) result += points[i].two * weights[i];
+				return result;
+			}
+		};
+
+		Vec3 ClosestOnSegment(Simplex& simplex)
+		{
+			const Vec3 a = simplex.points[0].point;
+			const Vec3 ab = simplex.points[1].point - a;
+			const Real sqrLength = Math::SqrMagnitude(ab);
+			const Real t = sqrLength > REAL_EPSILON ? -Math::Dot(a, ab) / sqrLength : 0;
+			if(t <= 0)
+			{
+				simplex.Keep({0}, {1});
+				return a;
+			}
+			if(t >= 1)
+			{
+				simplex.Keep({1}, {1});
+				return simplex.points[0].point;
+			}
+			simplex.weights = {1 - t, t, 0, 0};
+			return a + ab * t;
+		}
+
+		/**
+		 * Closest point of the triangle to the origin, from Real-Time Collision Detection (C. Ericson) 5.1.5.
+		 */
+		Vec3 ClosestOnTriangle(Simplex& simplex)
+		{
+			const Vec3 a = simplex.points[0].point;
+			const Vec3 b = simplex.points[1].point;
+			const Vec3 c = simplex.points[2].point;
+			const Vec3 ab = b - a;
+			const Vec3 ac = c - a;
+
+			const Real d1 = -Math::Dot(ab, a);
+			const Real d2 = -Math::Dot(ac, a);
+			if(d1 <= 0 && d2 <= 0)
+			{
+				simplex.Keep({0}, {1});
+				return a;
+			}
+
+			const Real d3 = -Math::Dot(ab, b);
+			const Real d4 = -Math::Dot(ac, b);
+			if(d3 >= 0 && d4 <= d3)
+			{
+				simplex.Keep({1}, {1});
+				return b;
+			}
+
+			const Real vc = d1 * d4 - d3 * d2;
+			if(vc <= 0 && d1 >= 0 && d3 <= 0)
+			{
+				const Real v = d1 / (d1 - d3);
+				simplex.Keep({0, 1}, {1 - v, v});
+				return a + ab * v;
+			}
+
+			const Real d5 = -Math::Dot(ab, c);
+			const Real d6 = -Math::Dot(ac, c);
+			if(d6 >= 0 && d5 <= d6)
+			{
+				simplex.Keep({2}, {1});
+				return c;
+			}
+
+			const Real vb = d5 * d2 - d1 * d6;
+			if(vb <= 0 && d2 >= 0 && d6 <= 0)
+			{
+				const Real w = d2 / (d2 - d6);
+				simplex.Keep({0, 2}, {1 - w, w});
+				return a + ac * w;
+			}
+
+			const Real va = d3 * d6 - d5 * d4;
+			if(va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+			{
+				const Real w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+				simplex.Keep({1, 2}, {1 - w, w});
+				return b + (c - b) * w;
+			}
+
+			const Real sum = va + vb + vc;
+			if(sum <= REAL_EPSILON)
+			{
+				// Degenerated triangle, all its points are on a line.
+				simplex.Keep({0, 1}, {1, 0});
+				return ClosestOnSegment(simplex);
+			}
+			const Real v = vb / sum;
+			const Real w = vc / sum;
+			simplex.weights = {1 - v - w, v, w, 0};
+			return a + ab * v + ac * w;
+		}
+
+		/**
+		 * @return Whether the origin is inside the tetrahedron, otherwise the simplex is reduced to the closest face.
+		 */
+		bool ClosestOnTetrahedron(Simplex& simplex, Vec3& closest)
+		{
+			// The 3 points of each face followed by the opposite point.
+			static constexpr std::array<std::array<uint32_t, 4>, 4> faces = {{{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}}};
+
+			bool inside = true;
+			Real bestSqrDistance = REAL_MAX;
+			Simplex best;
+			for (const auto& face : faces)
+			{
+				const Vec3 a = simplex.points[face[0]].point;
+				const Vec3 normal = Math::Cross(simplex.points[face[1]].point - a, simplex.points[face[2]].point - a);
+				const Real originSide = -Math::Dot(a, normal);
+				const Real oppositeSide = Math::Dot(simplex.points[face[3]].point - a, normal);
+
+				// The origin is on the same side of the face as the opposite point.
+				if(originSide * oppositeSide >= 0 && Math::Abs(oppositeSide) > REAL_EPSILON) continue;
+
+				inside = false;
+				Simplex triangle;
+				triangle.size = 3;
+				triangle.points = {simplex.points[face[0]], simplex.points[face[1]], simplex.points[face[2]], SupportPoint()};
+				const Vec3 point = ClosestOnTriangle(triangle);
+				const Real sqrDistance = Math::SqrMagnitude(point);
+				if(sqrDistance < bestSqrDistance)
+				{
+					bestSqrDistance = sqrDistance;
+					best = triangle;
+					closest = point;
+				}
+			}
+
+			if(inside)
+			{
+				closest = Vec3(0);
+				return true;
+			}
+			simplex = best;
+			return false;
+		}
+
+		/**
+		 * @return Whether the origin is in the Minkowski difference (i.e. the shapes overlap).
+		 */
+		bool RunGJK(const MinkowskiDifference& shapes, Simplex& simplex, Vec3& closest)
+		{
+			VXM_PROFILE_FUNCTION();
+			simplex = Simplex();
+			simplex.points[0] = shapes.Support(shapes.GetInitialDirection());
+			simplex.size = 1;
+			closest = simplex.points[0].point;
+
+			for (uint32_t iteration = 0; iteration < s_GJKMaxIterations; ++iteration)
+			{
+				const Real sqrDistance = Math::SqrMagnitude(closest);
+				if(sqrDistance <= s_GJKTolerance * s_GJKTolerance) return true;
+
+				const SupportPoint support = shapes.Support(-closest);
+
+				// The new point doesn't get closer to the origin, the closest point has been found.
+				if(sqrDistance - Math::Dot(closest, support.point) <= sqrDistance * s_GJKRelativeTolerance) return false;
+
+				for (uint32_t i = 0; i < simplex.size; ++i)
+				{
+					if(Math::SqrMagnitude(simplex.points[i].point - support.point) <= s_GJKTolerance * s_GJKTolerance) return false;
+				}
+
+				simplex.points[simplex.size++] = support;
+				switch (simplex.size)
+				{
+					case 2: closest = ClosestOnSegment(simplex); break;
+					case 3: closest = ClosestOnTriangle(simplex); break;
+					case 4: if(ClosestOnTetrahedron(simplex, closest)) return true; break;
+					default: VXM_CORE_ASSERT(false, "The simplex has {0} points.", simplex.size); return false;
+				}
+			}
+
+			return Math::SqrMagnitude(closest) <= s_GJKTolerance * s_GJKTolerance;
+		}
+
+		/**
+		 * @brief Add points to the simplex until it is a tetrahedron, the GJK can stop on a smaller simplex when the origin is on it.
+		 * @return false if the difference is flat (i.e. the shapes only touch).
+		 */
+		bool BlowUpSimplex(const MinkowskiDifference& shapes, Simplex& simplex)
+		{
+			static const std::array<Vec3, 6> axes = {Vec3(1, 0, 0), Vec3(-1, 0, 0), Vec3(0, 1, 0), Vec3(0, -1, 0), Vec3(0, 0, 1), Vec3(0, 0, -1)};
+			const Real sqrTolerance = s_GJKTolerance * s_GJKTolerance;
+
+			if(simplex.size == 1)
+			{
+				for (const Vec3& axis : axes)
+				{
+					const SupportPoint support = shapes.Support(axis);
+					if(Math::SqrMagnitude(support.point - simplex.points[0].point) > sqrTolerance)
+					{
+						simplex.points[simplex.size++] = support;
+						break;
+					}
+				}
+			}
+
+			if(simplex.size == 2)
+			{
+				const Vec3 line = simplex.points[1].point - simplex.points[0].point;
+				for (const Vec3& axis : axes)
+				{
+					const Vec3 direction = Math::Cross(line, axis);
+					if(Math::SqrMagnitude(direction) <= REAL_EPSILON) continue;
+					const SupportPoint support = shapes.Support(direction);
+					if(Math::SqrMagnitude(Math::Cross(support.point - simplex.points[0].point, line)) > sqrTolerance * Math::SqrMagnitude(line))
+					{
+						simplex.points[simplex.size++] = support;
+						break;
+					}
+				}
+			}
+
+			if(simplex.size == 3)
+			{
+				const Vec3 normal = Math::Cross(simplex.points[1].point - simplex.points[0].point, simplex.points[2].point - simplex.points[0].point);
+				for (const Vec3& direction : {normal, -normal})
+				{
+					const SupportPoint support = shapes.Support(direction);
+					if(Math::Abs(Math::Dot(support.point - simplex.points[0].point, normal)) > s_GJKTolerance * Math::Magnitude(normal))
+					{
+						simplex.points[simplex.size++] = support;
+						break;
+					}
+				}
+			}
+
+			return simplex.size == 4;
+		}
+
+		struct PolytopeFace
+		{
+			std::array<uint32_t, 3> indices;
+			// Pointing outward.
+			Vec3 normal;
+			// The distance of the plane of the face to the origin.
+			Real distance;
+		};
+
+		bool MakeFace(const std::vector<SupportPoint>& points, uint32_t a, uint32_t b, uint32_t c, PolytopeFace& face)
+		{
+			const Vec3 normal = Math::Cross(points[b].point - points[a].point, points[c].point - points[a].point);
+			const Real length = Math::Magnitude(normal);
+			if(length <= REAL_EPSILON) return false;
+			face.indices = {a, b, c};
+			face.normal = normal / length;
+			face.distance = Math::Dot(face.normal, points[a].point);
+			return true;
+		}
+
+		void AddHorizonEdge(std::vector<std::pair<uint32_t, uint32_t>>& edges, uint32_t a, uint32_t b)
+		{
+			// An edge shared by two removed faces is inside the hole.
+			for (auto it = edges.begin(); it != edges.end(); ++it)
+			{
+				if(it->first == b && it->second == a)
+				{
+					edges.erase(it);
+					return;
+				}
+			}
+			edges.emplace_back(a, b);
+		}
+
+		void FillPenetration(const std::vector<SupportPoint>& points, const PolytopeFace& face, ConvexPenetration& penetration)
+		{
+			const SupportPoint& a = points[face.indices[0]];
+			const SupportPoint& b = points[face.indices[1]];
+			const SupportPoint& c = points[face.indices[2]];
+
+			// Barycentric coordinates of the projection of the origin on the face.
+			const Vec3 p = face.normal * face.distance;
+			const Vec3 v0 = b.point - a.point;
+			const Vec3 v1 = c.point - a.point;
+			const Vec3 v2 = p - a.point;
+			const Real d00 = Math::Dot(v0, v0);
+			const Real d01 = Math::Dot(v0, v1);
+			const Real d11 = Math::Dot(v1, v1);
+			const Real d20 = Math::Dot(v2, v0);
+			const Real d21 = Math::Dot(v2, v1);
+			const Real denominator = d00 * d11 - d01 * d01;
+
+			Real v = 0;
+			Real w = 0;
+			if(Math::Abs(denominator) > REAL_EPSILON)
+			{
+				v = (d11 * d20 - d01 * d21) / denominator;
+				w = (d00 * d21 - d01 * d20) / denominator;
+			}
+			const Real u = 1 - v - w;
+
+			penetration.normal = face.normal;
+			penetration.depth = Math::Max(face.distance, (Real)0);
+			penetration.pointOne = a.one * u + b.one * v + c.one * w;
+			penetration.pointTwo = a.two * u + b.two * v + c.two * w;
+		}
+
+		bool RunEPA(const MinkowskiDifference& shapes, Simplex simplex, ConvexPenetration& penetration)
+		{
+			VXM_PROFILE_FUNCTION();
+			if(!BlowUpSimplex(shapes, simplex)) return false;
+
+			std::vector<SupportPoint> points(simplex.points.begin(), simplex.points.end());
+			// Wind the tetrahedron so the normals of its faces point outward.
+			if(Math::Dot(Math::Cross(points[1].point - points[0].point, points[2].point - points[0].point), points[3].point - points[0].point) > 0)
+			{
+				std::swap(points[1], points[2]);
+			}
+
+			std::vector<PolytopeFace> faces;
+			faces.reserve(64);
+			static constexpr std::array<std::array<uint32_t, 3>, 4> tetrahedron = {{{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}}};
+			for (const auto& indices : tetrahedron)
+			{
+				PolytopeFace face;
+				if(!MakeFace(points, indices[0], indices[1], indices[2], face)) return false;
+				faces.push_back(face);
+			}
+
+			std::vector<std::pair<uint32_t, uint32_t>> edges;
+			uint64_t closest = 0;
+			for (uint32_t iteration = 0; iteration < s_EPAMaxIterations; ++iteration)
+			{
+				closest = 0;
+				for (uint64_t i = 1; i < faces.size(); ++i)
+				{
+					if(faces[i].distance < faces[closest].distance) closest = i;
+				}
+
+				const PolytopeFace face = faces[closest];
+				const SupportPoint support = shapes.Support(face.normal);
+				if(Math::Dot(support.point, face.normal) - face.distance <= s_EPATolerance)
+				{
+					FillPenetration(points, face, penetration);
+					return true;
+				}
+
+				const uint32_t index = static_cast<uint32_t>(points.size());
+				points.push_back(support);
+
+				// Remove the faces seen from the new point and fill the hole with faces connected to it.
+				edges.clear();
+				for (uint64_t i = 0; i < faces.size();)
+				{
+					if(Math::Dot(faces[i].normal, support.point - points[faces[i].indices[0]].point) > 0)
+					{
+						const auto& indices = faces[i].indices;
+						AddHorizonEdge(edges, indices[0], indices[1]);
+						AddHorizonEdge(edges, indices[1], indices[2]);
+						AddHorizonEdge(edges, indices[2], indices[0]);
+						faces[i] = faces.back();
+						faces.pop_back();
+					}
+					else
+					{
+						++i;
+					}
+				}
+
+				for (const auto& [a, b] : edges)
+				{
+					PolytopeFace newFace;
+					if(MakeFace(points, a, b, index, newFace)) faces.push_back(newFace);
+				}
+
+				if(faces.empty()) return false;
+			}
+
+			// Out of iterations, the closest face is still a good approximation.
+			closest = 0;
+			for (uint64_t i = 1; i < faces.size(); ++i)
+			{
+				if(faces[i].distance < faces[closest].distance) closest = i;
+			}
+			FillPenetration(points, faces[closest], penetration);
+			return true;
+		}
+
+		ConvexDistance GetDistance(const MinkowskiDifference& shapes)
+		{
+			Simplex simplex;
+			Vec3 closest;
+			ConvexDistance result;
+			result.overlap = RunGJK(shapes, simplex, closest);
+			result.distance = result.overlap ? 0 : Math::Magnitude(closest);
+			result.pointOne = simplex.GetPointOne();
+			result.pointTwo = simplex.GetPointTwo();
+			return result;
+		}
+
+		bool GetPenetration(const MinkowskiDifference& shapes, ConvexPenetration& penetration)
+		{
+			Simplex simplex;
+			Vec3 closest;
+			if(!RunGJK(shapes, simplex, closest)) return false;
+			return RunEPA(shapes, simplex, penetration);
+		}
+	}
+
+	bool GJK::Intersect(const PrimitiveCollider& one, const PrimitiveCollider& two)
+	{
+		VXM_PROFILE_FUNCTION();
+		Simplex simplex;
+		Vec3 closest;
+		return RunGJK({&one, Vec3(0), two}, simplex, closest);
+	}
+
+	ConvexDistance GJK::Distance(const PrimitiveCollider& one, const PrimitiveCollider& two)
+	{
+		VXM_PROFILE_FUNCTION();
+		return GetDistance({&one, Vec3(0), two});
+	}
+
+	ConvexDistance GJK::Distance(const Vec3& point, const PrimitiveCollider& shape)
+	{
+		VXM_PROFILE_FUNCTION();
+		return GetDistance({nullptr, point, shape});
+	}
+
+	bool GJK::Penetration(const PrimitiveCollider& one, const PrimitiveCollider& two, ConvexPenetration& penetration)
+	{
+		VXM_PROFILE_FUNCTION();
+		return GetPenetration({&one, Vec3(0), two}, penetration);
+	}
+
+	bool GJK::Penetration(const Vec3& point, const PrimitiveCollider& shape, ConvexPenetration& penetration)
+	{
+		VXM_PROFILE_FUNCTION();
+		return GetPenetration({nullptr, point, shape}, penetration);
+	}
+} // namespace Voxymore::Core
@@ -149,9 +149,9 @@ namespace Voxymore::Core
 		this->restitution = restitution;
 	}
 
-	CollisionData::CollisionData() : contacts(10)
+	CollisionData::CollisionData()
 	{
-//		contactsLeft = contacts.size();
+		contacts.reserve(10);
 	}
 
 	CollisionData::~CollisionData()
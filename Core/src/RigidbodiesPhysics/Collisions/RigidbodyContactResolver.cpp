@@ -3,48 +3,482 @@
 //
 
 #include "Voxymore/RigidbodiesPhysics/Collisions/RigidbodyContactResolver.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyIslands.hpp"
+#include <algorithm>
+#include <functional>
 
 
 namespace Voxymore::Core
 {
+	size_t RigidbodyContactKeyHash::operator()(const RigidbodyContactKey& key) const
+	{
+		size_t hash = std::hash<uint32_t>{}(entt::to_integral(key.one));
+		hash ^= std::hash<uint32_t>{}(entt::to_integral(key.two)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		hash ^= std::hash<uint32_t>{}(key.feature) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		return hash;
+	}
 
 	RigidbodyContactResolver::RigidbodyContactResolver() : iterations(0), iterationsUsed(0) {}
 	RigidbodyContactResolver::RigidbodyContactResolver(uint32_t iterations) : iterations(iterations), iterationsUsed(0) {}
 
-	void RigidbodyContactResolver::ResolveContacts(TimeStep ts, std::vector<RigidbodyContact>& contacts)
+	void RigidbodyContactResolver::ResolveContacts(TimeStep ts, std::vector<RigidbodyContact>& contacts, const std::vector<RigidbodyJoint>& joints)
+	{
+		VXM_PROFILE_FUNCTION();
+		iterationsUsed = 0;
+
+		VXM_CORE_CHECK(iterations > 0, "No iteration will be done as iterations = {0}", iterations);
+		if(ts.GetSeconds() <= 0) return;
+
+		PrepareContacts(ts.GetSeconds(), contacts);
+		PrepareJoints(ts.GetSeconds(), joints);
+		iterationsUsed = SolveRange(0, m_Constraints.size(), 0, m_JointRows.size());
+		StoreImpulses();
+	}
+
+	void RigidbodyContactResolver::ResolveContacts(TimeStep ts, std::vector<RigidbodyContact>& contacts, const std::vector<RigidbodyJoint>& joints, const RigidbodyIslands& islands, JobSystem& jobSystem)
 	{
 		VXM_PROFILE_FUNCTION();
-		uint32_t i;
 		iterationsUsed = 0;
 
 		VXM_CORE_CHECK(iterations > 0, "No iteration will be done as iterations = {0}", iterations);
-		VXM_CORE_CHECK(iterations >= contacts.size(), "There is not enough iterations to cover all the m_Contacts... {0} iterations for {1} m_Contacts", iterations, contacts.size());
-/*
-		while (iterationsUsed < iterations)
+		if(ts.GetSeconds() <= 0) return;
+
+		PrepareContacts(ts.GetSeconds(), contacts);
+		PrepareJoints(ts.GetSeconds(), joints);
+		SortByIsland(islands);
+
+		m_Jobs.clear();
+		m_JobIterations.clear();
+		const size_t islandCount = m_IslandRanges.empty() ? 0 : m_IslandRanges.size() - 1;
+		size_t firstIsland = 0;
+		while (firstIsland < islandCount)
+		{
+			size_t lastIsland = firstIsland + 1;
+			while (lastIsland < islandCount && (m_IslandRanges[lastIsland] - m_IslandRanges[firstIsland]) + (m_JointIslandRanges[lastIsland] - m_JointIslandRanges[firstIsland]) < m_MinConstraintsPerJob) ++lastIsland;
+
+			const size_t job = m_JobIterations.size();
+			m_JobIterations.push_back(0);
+			// Each island is solved on its own so the result doesn't depend on how the islands are grouped.
+			m_Jobs.push_back(jobSystem.Schedule([this, job, firstIsland, lastIsland]() {
+				VXM_PROFILE_SCOPE("RigidbodyContactResolver::ResolveContacts - Island Job");
+				for (size_t island = firstIsland; island < lastIsland; ++island)
+				{
+					m_JobIterations[job] = std::max(m_JobIterations[job], SolveRange(m_IslandRanges[island], m_IslandRanges[island + 1], m_JointIslandRanges[island], m_JointIslandRanges[island + 1]));
+				}
+			}));
+			firstIsland = lastIsland;
+		}
+
+		jobSystem.WaitFor(m_Jobs);
+		m_Jobs.clear();
+		for (uint32_t used : m_JobIterations) iterationsUsed = std::max(iterationsUsed, used);
+
+		StoreImpulses();
+	}
+
+	void RigidbodyContactResolver::SortByIsland(const RigidbodyIslands& islands)
+	{
+		VXM_PROFILE_FUNCTION();
+		const uint32_t islandCount = islands.GetIslandCount();
+		m_ConstraintIslands.resize(m_Constraints.size());
+		m_IslandRanges.assign(islandCount + 1, 0);
+		for (size_t i = 0; i < m_Constraints.size(); ++i)
+		{
+			// At least one body has a finite mass, otherwise the constraint would have been dropped.
+			const ContactConstraint& constraint = m_Constraints[i];
+			uint32_t island = constraint.inverseMass[0] > 0 ? islands.GetIslandIndex(constraint.bodies[0]) : islands.GetIslandIndex(constraint.bodies[1]);
+			VXM_CORE_ASSERT(island < islandCount, "The body of the contact is not in any island.");
+			m_ConstraintIslands[i] = island;
+			++m_IslandRanges[island + 1];
+		}
+		for (uint32_t i = 0; i < islandCount; ++i) m_IslandRanges[i + 1] += m_IslandRanges[i];
+
+		// Counting sort, stable so the constraints are solved in the same order as the contacts.
+		std::vector<ContactConstraint> sorted(m_Constraints.size());
+		std::vector<size_t> cursor(m_IslandRanges.begin(), m_IslandRanges.end() - 1);
+		for (size_t i = 0; i < m_Constraints.size(); ++i)
+		{
+			sorted[cursor[m_ConstraintIslands[i]]++] = m_Constraints[i];
+		}
+		m_Constraints.swap(sorted);
+
+		// Same thing for the joint rows.
+		std::vector<uint32_t> rowIslands(m_JointRows.size());
+		m_JointIslandRanges.assign(islandCount + 1, 0);
+		for (size_t i = 0; i < m_JointRows.size(); ++i)
+		{
+			const JointRow& row = m_JointRows[i];
+			uint32_t island = row.inverseMass[0] > 0 ? islands.GetIslandIndex(row.bodies[0]) : islands.GetIslandIndex(row.bodies[1]);
+			VXM_CORE_ASSERT(island < islandCount, "The body of the joint is not in any island.");
+			rowIslands[i] = island;
+			++m_JointIslandRanges[island + 1];
+		}
+		for (uint32_t i = 0; i < islandCount; ++i) m_JointIslandRanges[i + 1] += m_JointIslandRanges[i];
+
+		std::vector<JointRow> sortedRows(m_JointRows.size());
+		std::vector<size_t> rowCursor(m_JointIslandRanges.begin(), m_JointIslandRanges.end() - 1);
+		for (size_t i = 0; i < m_JointRows.size(); ++i)
+		{
+			sortedRows[rowCursor[rowIslands[i]]++] = m_JointRows[i];
+		}
+		m_JointRows.swap(sortedRows);
+	}
+
+	uint32_t RigidbodyContactResolver::SolveRange(size_t begin, size_t end, size_t jointBegin, size_t jointEnd)
+	{
+		if(m_WarmStarting) WarmStart(begin, end, jointBegin, jointEnd);
+
+		uint32_t used = 0;
+		while (used < iterations)
+		{
+			++used;
+			if(SolveVelocities(begin, end, jointBegin, jointEnd) < m_Tolerance) break;
+		}
+		return used;
+	}
+
+	void RigidbodyContactResolver::PrepareContacts(Real ts, const std::vector<RigidbodyContact>& contacts)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Constraints.clear();
+		m_Constraints.reserve(contacts.size());
+
+		for (const RigidbodyContact& contact : contacts)
+		{
+			ContactConstraint constraint;
+			constraint.bodies = contact.bodies;
+			constraint.normal = contact.contactNormal;
+			constraint.friction = contact.friction;
+			constraint.key = {contact.entities[0], contact.entities[1], contact.feature};
+
+			for (int i = 0; i < 2; ++i)
+			{
+				Rigidbody* body = constraint.bodies[i];
+				if(body && body->HasFiniteMass())
+				{
+					constraint.inverseMass[i] = body->GetInverseMass();
+					constraint.inverseInertia[i] = body->CalculateWorldInverseInertiaTensor();
+					constraint.relativePositions[i] = contact.contactPoint - body->GetPosition();
+				}
+				else
+				{
+					constraint.inverseMass[i] = 0;
+					constraint.inverseInertia[i] = Mat3(0);
+					constraint.relativePositions[i] = body ? contact.contactPoint - body->GetPosition() : Vec3(0);
+				}
+			}
+
+			if(constraint.inverseMass[0] <= 0 && constraint.inverseMass[1] <= 0) continue;
+
+			// Deterministic orthonormal basis around the normal.
+			const Vec3& n = constraint.normal;
+			if(Math::Abs(n.x) >= (Real)0.57735)
+			{
+				constraint.tangents[0] = Math::Normalize(Vec3(n.y, -n.x, 0));
+			}
+			else
+			{
+				constraint.tangents[0] = Math::Normalize(Vec3(0, n.z, -n.y));
+			}
+			constraint.tangents[1] = Math::Cross(n, constraint.tangents[0]);
+
+			Real k = GetEffectiveMass(constraint, constraint.normal);
+			constraint.normalMass = k > 0 ? (Real)1 / k : 0;
+			for (int i = 0; i < 2; ++i)
+			{
+				Real kt = GetEffectiveMass(constraint, constraint.tangents[i]);
+				constraint.tangentMass[i] = kt > 0 ? (Real)1 / kt : 0;
+			}
+
+			// The normal points toward the first body, so a negative normal velocity means the bodies get closer.
+			Real normalVelocity = Math::Dot(GetRelativeVelocity(constraint), constraint.normal);
+			constraint.bias = (m_Baumgarte / ts) * Math::Max(contact.penetration - m_Slop, (Real)0);
+			if(normalVelocity < -m_RestitutionThreshold)
+			{
+				constraint.bias = Math::Max(constraint.bias, -contact.restitution * normalVelocity);
+			}
+
+			constraint.normalImpulse = 0;
+			constraint.tangentImpulse = {0, 0};
+			m_Constraints.push_back(constraint);
+		}
+	}
+
+	void RigidbodyContactResolver::PrepareJoints(Real ts, const std::vector<RigidbodyJoint>& joints)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_JointRows.clear();
+		m_JointRows.reserve(joints.size() * 3);
+
+		for (const RigidbodyJoint& joint : joints)
 		{
-			Real max = REAL_MAX;
-			uint32_t maxIndex = contacts.size();
-			for (i = 0; i < contacts.size(); ++i)
+			const bool firstMoves = joint.bodies[0] && joint.bodies[0]->HasFiniteMass();
+			const bool secondMoves = joint.bodies[1] && joint.bodies[1]->HasFiniteMass();
+			if(!firstMoves && !secondMoves) continue;
+
+			const Vec3 delta = joint.anchors[0] - joint.anchors[1];
+			switch (joint.type)
 			{
-				if(!contacts[i].bodies[0] && !contacts[i].bodies[1]) continue;
-				Real sepVel = contacts[i].CalculateSeparatingVelocity();
-				if(sepVel < max && (sepVel < 0 || contacts[0].penetration > 0))
+				case JointType::Distance:
+				case JointType::Rope:
+				{
+					const Real distance = Math::Magnitude(delta);
+					// The direction is undefined when the anchors are merged, nothing to push or pull then.
+					if(distance <= REAL_EPSILON) break;
+					const Vec3 direction = delta / distance;
+					const Real error = distance - joint.length;
+					if(joint.type == JointType::Distance)
+					{
+						AddLinearRow(joint, 0, direction, error, ts);
+					}
+					else
+					{
+						// A slack rope lets the anchors get closer, and apart until the rope is tight at the end of the step.
+						AddLinearRow(joint, 0, direction, error, ts, -REAL_MAX, 0);
+						if(error < 0) m_JointRows.back().bias = -error / ts;
+					}
+					break;
+				}
+				case JointType::BallSocket:
+				case JointType::Hinge:
 				{
-					max = sepVel;
-					maxIndex = i;
+					AddLinearRow(joint, 0, Vec3(1, 0, 0), delta.x, ts);
+					AddLinearRow(joint, 1, Vec3(0, 1, 0), delta.y, ts);
+					AddLinearRow(joint, 2, Vec3(0, 0, 1), delta.z, ts);
+					if(joint.type != JointType::Hinge) break;
+
+					// Block the rotations around the two directions orthogonal to the axis of the first body.
+					const Vec3& a = joint.axes[0];
+					Vec3 b = Math::Abs(a.x) >= (Real)0.57735 ? Math::Normalize(Vec3(a.y, -a.x, 0)) : Math::Normalize(Vec3(0, a.z, -a.y));
+					Vec3 c = Math::Cross(a, b);
+					// Rotating the first axis around a x a' brings it back on the second one.
+					const Vec3 misalignment = Math::Cross(joint.axes[0], joint.axes[1]);
+					AddAngularRow(joint, 3, b, -Math::Dot(misalignment, b), ts);
+					AddAngularRow(joint, 4, c, -Math::Dot(misalignment, c), ts);
+					break;
 				}
 			}
+		}
+	}
+
+	void RigidbodyContactResolver::AddLinearRow(const RigidbodyJoint& joint, uint32_t row, const Vec3& direction, Real error, Real ts, Real lowerImpulse, Real upperImpulse)
+	{
+		JointRow jointRow;
+		jointRow.bodies = joint.bodies;
+		jointRow.linear = direction;
+		for (int i = 0; i < 2; ++i)
+		{
+			Rigidbody* body = joint.bodies[i];
+			const Vec3 relativePosition = body ? joint.anchors[i] - body->GetPosition() : Vec3(0);
+			jointRow.angular[i] = Math::Cross(relativePosition, direction) * (i == 0 ? (Real)1 : (Real)-1);
+			const bool finite = body && body->HasFiniteMass();
+			jointRow.inverseMass[i] = finite ? body->GetInverseMass() : 0;
+			jointRow.inverseInertia[i] = finite ? body->CalculateWorldInverseInertiaTensor() : Mat3(0);
+		}
+
+		Real k = (jointRow.inverseMass[0] + jointRow.inverseMass[1]) * Math::Dot(direction, direction);
+		for (int i = 0; i < 2; ++i) k += Math::Dot(jointRow.angular[i], jointRow.inverseInertia[i] * jointRow.angular[i]);
+		if(k <= 0) return;
+
+		jointRow.mass = (Real)1 / k;
+		jointRow.bias = -(m_Baumgarte / ts) * error;
+		jointRow.lowerImpulse = lowerImpulse;
+		jointRow.upperImpulse = upperImpulse;
+		jointRow.impulse = 0;
+		jointRow.key = {joint.entities[0], joint.entities[1], row};
+		m_JointRows.push_back(jointRow);
+	}
+
+	void RigidbodyContactResolver::AddAngularRow(const RigidbodyJoint& joint, uint32_t row, const Vec3& axis, Real error, Real ts)
+	{
+		JointRow jointRow;
+		jointRow.bodies = joint.bodies;
+		jointRow.linear = Vec3(0);
+		jointRow.angular = {axis, -axis};
+		for (int i = 0; i < 2; ++i)
+		{
+			Rigidbody* body = joint.bodies[i];
+			const bool finite = body && body->HasFiniteMass();
+			jointRow.inverseMass[i] = finite ? body->GetInverseMass() : 0;
+			jointRow.inverseInertia[i] = finite ? body->CalculateWorldInverseInertiaTensor() : Mat3(0);
+		}
+
+		Real k = 0;
+		for (int i = 0; i < 2; ++i) k += Math::Dot(jointRow.angular[i], jointRow.inverseInertia[i] * jointRow.angular[i]);
+		if(k <= 0) return;
+
+		jointRow.mass = (Real)1 / k;
+		jointRow.bias = -(m_Baumgarte / ts) * error;
+		jointRow.lowerImpulse = -REAL_MAX;
+		jointRow.upperImpulse = REAL_MAX;
+		jointRow.impulse = 0;
+		jointRow.key = {joint.entities[0], joint.entities[1], row};
+		m_JointRows.push_back(jointRow);
+	}
+
+	void RigidbodyContactResolver::WarmStart(size_t begin, size_t end, size_t jointBegin, size_t jointEnd)
+	{
+		VXM_PROFILE_FUNCTION();
+		for (size_t i = jointBegin; i < jointEnd; ++i)
+		{
+			JointRow& row = m_JointRows[i];
+			auto it = m_JointCache.find(row.key);
+			if(it == m_JointCache.end()) continue;
+			row.impulse = Math::Clamp(it->second, row.lowerImpulse, row.upperImpulse);
+			ApplyImpulse(row, row.impulse);
+		}
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			ContactConstraint& constraint = m_Constraints[i];
+			auto it = m_Cache.find(constraint.key);
+			if(it == m_Cache.end()) continue;
+
+			const RigidbodyContactImpulse& cached = it->second;
+			constraint.normalImpulse = cached.normalImpulse;
+			constraint.tangentImpulse[0] = Math::Dot(cached.tangentImpulse, constraint.tangents[0]);
+			constraint.tangentImpulse[1] = Math::Dot(cached.tangentImpulse, constraint.tangents[1]);
 
-			if(maxIndex == contacts.size())
+			Vec3 impulse = constraint.normal * constraint.normalImpulse + constraint.tangents[0] * constraint.tangentImpulse[0] + constraint.tangents[1] * constraint.tangentImpulse[1];
+			ApplyImpulse(constraint, impulse);
+		}
+	}
+
+	Real RigidbodyContactResolver::SolveVelocities(size_t begin, size_t end, size_t jointBegin, size_t jointEnd)
+	{
+		VXM_PROFILE_FUNCTION();
+		Real maxDelta = 0;
+		// The joints first so the contacts, solved last, have the final say.
+		for (size_t r = jointBegin; r < jointEnd; ++r)
+		{
+			JointRow& row = m_JointRows[r];
+			Real lambda = (row.bias - GetRowVelocity(row)) * row.mass;
+			Real newImpulse = Math::Clamp(row.impulse + lambda, row.lowerImpulse, row.upperImpulse);
+			lambda = newImpulse - row.impulse;
+			row.impulse = newImpulse;
+			ApplyImpulse(row, lambda);
+			maxDelta = Math::Max(maxDelta, Math::Abs(lambda));
+		}
+
+		for (size_t c = begin; c < end; ++c)
+		{
+			ContactConstraint& constraint = m_Constraints[c];
+			// Friction first as the normal constraint is the most important one and should be the last solved.
+			Real maxFriction = constraint.friction * constraint.normalImpulse;
+			for (int i = 0; i < 2; ++i)
 			{
-				break;
+				Real tangentVelocity = Math::Dot(GetRelativeVelocity(constraint), constraint.tangents[i]);
+				Real lambda = -tangentVelocity * constraint.tangentMass[i];
+				Real newImpulse = Math::Clamp(constraint.tangentImpulse[i] + lambda, -maxFriction, maxFriction);
+				lambda = newImpulse - constraint.tangentImpulse[i];
+				constraint.tangentImpulse[i] = newImpulse;
+				ApplyImpulse(constraint, constraint.tangents[i] * lambda);
+				maxDelta = Math::Max(maxDelta, Math::Abs(lambda));
 			}
 
-			contacts[maxIndex].Resolve(ts);
-			++iterationsUsed;
+			Real normalVelocity = Math::Dot(GetRelativeVelocity(constraint), constraint.normal);
+			Real lambda = (constraint.bias - normalVelocity) * constraint.normalMass;
+			// The accumulated impulse is clamped, not the delta, so an iteration can remove what the previous one applied in excess.
+			Real newImpulse = Math::Max(constraint.normalImpulse + lambda, (Real)0);
+			lambda = newImpulse - constraint.normalImpulse;
+			constraint.normalImpulse = newImpulse;
+			ApplyImpulse(constraint, constraint.normal * lambda);
+			maxDelta = Math::Max(maxDelta, Math::Abs(lambda));
+		}
+		return maxDelta;
+	}
+
+	void RigidbodyContactResolver::StoreImpulses()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Cache.clear();
+		m_JointCache.clear();
+		if(!m_WarmStarting) return;
+
+		m_JointCache.reserve(m_JointRows.size());
+		for (const JointRow& row : m_JointRows)
+		{
+			m_JointCache[row.key] = row.impulse;
+		}
+
+		m_Cache.reserve(m_Constraints.size());
+		for (const ContactConstraint& constraint : m_Constraints)
+		{
+			RigidbodyContactImpulse& impulse = m_Cache[constraint.key];
+			impulse.normalImpulse = constraint.normalImpulse;
+			impulse.tangentImpulse = constraint.tangents[0] * constraint.tangentImpulse[0] + constraint.tangents[1] * constraint.tangentImpulse[1];
+		}
+	}
+
+	void RigidbodyContactResolver::ApplyImpulse(ContactConstraint& constraint, const Vec3& impulse)
+	{
+		// The angular velocity of the rigidbodies is stored in degrees per seconds.
+		if(constraint.inverseMass[0] > 0)
+		{
+			constraint.bodies[0]->AddLinearVelocity(impulse * constraint.inverseMass[0]);
+			constraint.bodies[0]->AddAngularVelocity(glm::degrees(constraint.inverseInertia[0] * Math::Cross(constraint.relativePositions[0], impulse)));
+		}
+		if(constraint.inverseMass[1] > 0)
+		{
+			constraint.bodies[1]->AddLinearVelocity(impulse * -constraint.inverseMass[1]);
+			constraint.bodies[1]->AddAngularVelocity(glm::degrees(constraint.inverseInertia[1] * Math::Cross(constraint.relativePositions[1], -impulse)));
+		}
+	}
+
+	void RigidbodyContactResolver::ApplyImpulse(JointRow& row, Real impulse)
+	{
+		// The angular velocity of the rigidbodies is stored in degrees per seconds.
+		if(row.inverseMass[0] > 0)
+		{
+			row.bodies[0]->AddLinearVelocity(row.linear * (impulse * row.inverseMass[0]));
+			row.bodies[0]->AddAngularVelocity(glm::degrees(row.inverseInertia[0] * row.angular[0] * impulse));
+		}
+		if(row.inverseMass[1] > 0)
+		{
+			row.bodies[1]->AddLinearVelocity(row.linear * (-impulse * row.inverseMass[1]));
+			row.bodies[1]->AddAngularVelocity(glm::degrees(row.inverseInertia[1] * row.angular[1] * impulse));
+		}
+	}
+
+	Real RigidbodyContactResolver::GetRowVelocity(const JointRow& row)
+	{
+		Real velocity = 0;
+		if(row.bodies[0])
+		{
+			velocity += Math::Dot(row.linear, row.bodies[0]->GetLinearVelocity()) + Math::Dot(row.angular[0], glm::radians(row.bodies[0]->GetAngularVelocity()));
+		}
+		if(row.bodies[1])
+		{
+			velocity += -Math::Dot(row.linear, row.bodies[1]->GetLinearVelocity()) + Math::Dot(row.angular[1], glm::radians(row.bodies[1]->GetAngularVelocity()));
+		}
+		return velocity;
+	}
+
+	Vec3 RigidbodyContactResolver::GetRelativeVelocity(const ContactConstraint& constraint)
+	{
+		Vec3 velocity(0);
+		if(constraint.bodies[0])
+		{
+			const Rigidbody& body = *constraint.bodies[0];
+			velocity += body.GetLinearVelocity() + Math::Cross(glm::radians(body.GetAngularVelocity()), constraint.relativePositions[0]);
+		}
+		if(constraint.bodies[1])
+		{
+			const Rigidbody& body = *constraint.bodies[1];
+			velocity -= body.GetLinearVelocity() + Math::Cross(glm::radians(body.GetAngularVelocity()), constraint.relativePositions[1]);
+		}
+		return velocity;
+	}
+
+	Real RigidbodyContactResolver::GetEffectiveMass(const ContactConstraint& constraint, const Vec3& direction)
+	{
+		Real k = constraint.inverseMass[0] + constraint.inverseMass[1];
+		for (int i = 0; i < 2; ++i)
+		{
+			Vec3 rn = Math::Cross(constraint.relativePositions[i], direction);
+			k += Math::Dot(rn, constraint.inverseInertia[i] * rn);
 		}
-*/
-		VXM_CORE_WARN("We should use resolve all the contacts encountered here.");
+		return k;
 	}
 
 	void RigidbodyContactResolver::SetIterations(uint32_t iterations)
@@ -52,4 +486,20 @@ namespace Voxymore::Core
 		this->iterations = iterations;
 	}
 
+	void RigidbodyContactResolver::SetWarmStarting(bool warmStarting)
+	{
+		m_WarmStarting = warmStarting;
+		if(!m_WarmStarting)
+		{
+			m_Cache.clear();
+			m_JointCache.clear();
+		}
+	}
+
+	void RigidbodyContactResolver::ClearCache()
+	{
+		m_Cache.clear();
+		m_JointCache.clear();
+	}
+
 } // namespace Voxymore::Core
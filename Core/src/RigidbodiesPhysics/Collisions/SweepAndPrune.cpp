@@ -0,0 +1,282 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/Collisions/SweepAndPrune.hpp"
+#include <algorithm>
+
+namespace Voxymore::Core
+{
+	SweepAndPrune::SweepAndPrune(Real margin, Real displacementMultiplier) : BroadPhase(margin, displacementMultiplier)
+	{
+	}
+
+	uint32_t SweepAndPrune::CreateProxy(const BoundingBox &box, Rigidbody *body, Entity entity, const CollisionFilter& filter, bool isStatic)
+	{
+		VXM_PROFILE_FUNCTION();
+		uint32_t proxy;
+		if(m_FreeList != NullNode)
+		{
+			proxy = m_FreeList;
+			m_FreeList = m_Proxies[proxy].next;
+		}
+		else
+		{
+			proxy = static_cast<uint32_t>(m_Proxies.size());
+			m_Proxies.emplace_back();
+		}
+
+		Proxy& p = m_Proxies[proxy];
+		p = Proxy();
+		p.box = ComputeFatBoundingBox(box, Vec3(0));
+		p.body = body;
+		p.entity = entity;
+		p.filter = filter;
+		p.isStatic = isStatic;
+		p.alive = true;
+
+		m_Endpoints.push_back({p.box.GetMin()[m_Axis], proxy, true});
+		m_Endpoints.push_back({p.box.GetMax()[m_Axis], proxy, false});
+		m_AddedEndpoints += 2;
+		m_EndpointsSorted = false;
+		++m_ProxyCount;
+		return proxy;
+	}
+
+	void SweepAndPrune::DestroyProxy(uint32_t proxy)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(proxy < m_Proxies.size() && m_Proxies[proxy].alive, "The proxy {0} doesn't exist.", proxy);
+
+		// Removing the endpoints right away would shift the whole array, they are removed all at once on the next update.
+		m_Proxies[proxy].alive = false;
+		m_DestroyedProxies.push_back(proxy);
+		m_EndpointsSorted = false;
+		--m_ProxyCount;
+	}
+
+	void SweepAndPrune::RemoveDestroyedProxies()
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_DestroyedProxies.empty()) return;
+
+		// Keeps the order of the remaining endpoints, so they stay sorted.
+		std::erase_if(m_Endpoints, [this](const Endpoint& endpoint) { return !m_Proxies[endpoint.proxy].alive; });
+
+		for (uint32_t proxy : m_DestroyedProxies)
+		{
+			m_Proxies[proxy] = Proxy();
+			m_Proxies[proxy].next = m_FreeList;
+			m_FreeList = proxy;
+		}
+		m_DestroyedProxies.clear();
+	}
+
+	bool SweepAndPrune::MoveProxy(uint32_t proxy, const BoundingBox &box, const Vec3 &displacement)
+	{
+		VXM_PROFILE_FUNCTION();
+		VXM_CORE_ASSERT(proxy < m_Proxies.size() && m_Proxies[proxy].alive, "The proxy {0} doesn't exist.", proxy);
+
+		Proxy& p = m_Proxies[proxy];
+		if(p.box.Contains(box))
+		{
+			return false;
+		}
+
+		p.box = ComputeFatBoundingBox(box, displacement);
+		m_EndpointsSorted = false;
+		return true;
+	}
+
+	void SweepAndPrune::SetProxyBody(uint32_t proxy, Rigidbody *body)
+	{
+		VXM_CORE_ASSERT(proxy < m_Proxies.size() && m_Proxies[proxy].alive, "The proxy {0} doesn't exist.", proxy);
+		m_Proxies[proxy].body = body;
+	}
+
+	void SweepAndPrune::SetProxyFilter(uint32_t proxy, const CollisionFilter& filter)
+	{
+		VXM_CORE_ASSERT(proxy < m_Proxies.size() && m_Proxies[proxy].alive, "The proxy {0} doesn't exist.", proxy);
+		// The pairs are found again on each sweep, nothing else to update.
+		m_Proxies[proxy].filter = filter;
+	}
+
+	void SweepAndPrune::SetProxyStatic(uint32_t proxy, bool isStatic)
+	{
+		VXM_CORE_ASSERT(proxy < m_Proxies.size() && m_Proxies[proxy].alive, "The proxy {0} doesn't exist.", proxy);
+		m_Proxies[proxy].isStatic = isStatic;
+	}
+
+	const BoundingBox& SweepAndPrune::GetFatBoundingBox(uint32_t proxy) const
+	{
+		VXM_CORE_ASSERT(proxy < m_Proxies.size() && m_Proxies[proxy].alive, "The proxy {0} doesn't exist.", proxy);
+		return m_Proxies[proxy].box;
+	}
+
+	uint32_t SweepAndPrune::GetPotentialContacts(std::vector<PotentialContact> &contacts)
+	{
+		VXM_PROFILE_FUNCTION();
+		RemoveDestroyedProxies();
+		if(m_ProxyCount == 0) return 0;
+
+		bool axisChanged = UpdateAxis();
+		if(axisChanged || !m_EndpointsSorted) SortEndpoints(axisChanged);
+
+		{
+			VXM_PROFILE_SCOPE("SweepAndPrune::GetPotentialContacts - Sweep");
+			m_Pairs.clear();
+			m_Active.clear();
+			for (const Endpoint& endpoint : m_Endpoints)
+			{
+				Proxy& proxy = m_Proxies[endpoint.proxy];
+				if(endpoint.isMin)
+				{
+					for (uint32_t other : m_Active)
+					{
+						if(proxy.isStatic && m_Proxies[other].isStatic) continue;
+						if(proxy.filter.ShouldCollide(m_Proxies[other].filter) && proxy.box.Overlaps(m_Proxies[other].box))
+						{
+							m_Pairs.push_back(MakePair(endpoint.proxy, other));
+						}
+					}
+					proxy.activeIndex = static_cast<uint32_t>(m_Active.size());
+					m_Active.push_back(endpoint.proxy);
+				}
+				else
+				{
+					// Swap and pop the proxy from the active list.
+					uint32_t last = m_Active.back();
+					m_Active[proxy.activeIndex] = last;
+					m_Proxies[last].activeIndex = proxy.activeIndex;
+					m_Active.pop_back();
+					proxy.activeIndex = NullNode;
+				}
+			}
+		}
+
+		// Sorted by proxy id to give the same contacts as the other broadphases.
+		std::sort(m_Pairs.begin(), m_Pairs.end());
+
+		contacts.reserve(contacts.size() + m_Pairs.size());
+		for (uint64_t pair : m_Pairs)
+		{
+			const Proxy& one = m_Proxies[GetFirst(pair)];
+			const Proxy& two = m_Proxies[GetSecond(pair)];
+			contacts.push_back({{std::pair<Rigidbody*, Entity>{one.body, one.entity}, std::pair<Rigidbody*, Entity>{two.body, two.entity}}, one.filter.isTrigger || two.filter.isTrigger});
+		}
+		return static_cast<uint32_t>(m_Pairs.size());
+	}
+
+	uint32_t SweepAndPrune::QueryProxies(const BoundingBox& box, std::vector<std::pair<Rigidbody*, Entity>>& bodies)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_ProxyCount == 0) return 0;
+		if(!m_EndpointsSorted) SortEndpoints(false);
+
+		// The proxies starting after the end of the box on the sweep axis cannot overlap it.
+		const size_t count = bodies.size();
+		const Real max = box.GetMax()[m_Axis];
+		for (const Endpoint& endpoint : m_Endpoints)
+		{
+			if(endpoint.value > max) break;
+			if(!endpoint.isMin) continue;
+			const Proxy& proxy = m_Proxies[endpoint.proxy];
+			if(proxy.box.Overlaps(box)) bodies.emplace_back(proxy.body, proxy.entity);
+		}
+		return static_cast<uint32_t>(bodies.size() - count);
+	}
+
+	void SweepAndPrune::Clear()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Proxies.clear();
+		m_Endpoints.clear();
+		m_Active.clear();
+		m_Pairs.clear();
+		m_DestroyedProxies.clear();
+		m_FreeList = NullNode;
+		m_ProxyCount = 0;
+		m_AddedEndpoints = 0;
+		m_EndpointsSorted = true;
+	}
+
+	bool SweepAndPrune::UpdateAxis()
+	{
+		VXM_PROFILE_FUNCTION();
+		Vec3 sum(0);
+		Vec3 sumSqr(0);
+		for (const Proxy& proxy : m_Proxies)
+		{
+			if(!proxy.alive) continue;
+			Vec3 center = proxy.box.GetCenter();
+			sum += center;
+			sumSqr += center * center;
+		}
+		Vec3 variance = sumSqr - (sum * sum) / (Real)m_ProxyCount;
+
+		int axis = 0;
+		if(variance[1] > variance[axis]) axis = 1;
+		if(variance[2] > variance[axis]) axis = 2;
+
+		// Only switch when the other axis is clearly better as it requires a full sort.
+		if(axis == m_Axis || variance[axis] <= variance[m_Axis] * (Real)2)
+		{
+			return false;
+		}
+
+		m_Axis = axis;
+		return true;
+	}
+
+	void SweepAndPrune::SortEndpoints(bool fullSort)
+	{
+		VXM_PROFILE_FUNCTION();
+		RemoveDestroyedProxies();
+		UpdateEndpoints();
+
+		// The insertion sort is only worth it when the endpoints are almost sorted.
+		if(fullSort || m_AddedEndpoints * 8 > m_Endpoints.size())
+		{
+			VXM_PROFILE_SCOPE("SweepAndPrune::SortEndpoints - Full sort");
+			std::sort(m_Endpoints.begin(), m_Endpoints.end());
+		}
+		else
+		{
+			InsertionSort();
+		}
+		m_AddedEndpoints = 0;
+		m_EndpointsSorted = true;
+	}
+
+	void SweepAndPrune::UpdateEndpoints()
+	{
+		VXM_PROFILE_FUNCTION();
+		for (Endpoint& endpoint : m_Endpoints)
+		{
+			endpoint.value = GetValue(endpoint);
+		}
+	}
+
+	void SweepAndPrune::InsertionSort()
+	{
+		VXM_PROFILE_FUNCTION();
+		for (size_t i = 1; i < m_Endpoints.size(); ++i)
+		{
+			Endpoint key = m_Endpoints[i];
+			size_t j = i;
+			while (j > 0 && key < m_Endpoints[j - 1])
+			{
+				m_Endpoints[j] = m_Endpoints[j - 1];
+				--j;
+			}
+			m_Endpoints[j] = key;
+		}
+	}
+
+	Real SweepAndPrune::GetValue(const Endpoint& endpoint) const
+	{
+		const BoundingBox& box = m_Proxies[endpoint.proxy].box;
+		return endpoint.isMin ? box.GetMin()[m_Axis] : box.GetMax()[m_Axis];
+	}
+} // namespace Voxymore::Core
+
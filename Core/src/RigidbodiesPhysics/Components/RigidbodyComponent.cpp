@@ -22,9 +22,11 @@ namespace Voxymore::Core
 		DeserializeField(node, m_LinearVelocity, "LinearVelocity", Vec3, Vec3(0));
 		DeserializeField(node, m_AngularVelocity, "AngularVelocity", Vec3, Vec3(0));
 		DeserializeField(node, m_InverseInertiaTensor, "InverseInertiaTensor", Mat3, Math::Identity<Mat3>());
+		InvalidateInertiaCache();
 		DeserializeField(node, m_ForceAccumulate, "ForceAccumulate", Vec3, Vec3(0));
 		DeserializeField(node, m_TorqueAccumulate, "TorqueAccumulate", Vec3, Vec3(0));
 		DeserializeField(node, m_Acceleration, "Acceleration", Vec3, Math::Gravity);
+		DeserializeField(node, m_Continuous, "ContinuousCollision", bool, false);
 //		DeserializeField(node, m_IsAwake, "IsAwake", bool, false);
 
 		if(node["Disable"].as<bool>(false) && !entity.HasComponent<DisableRigidbody>())
@@ -50,10 +52,53 @@ namespace Voxymore::Core
 		out << KEYVAL("ForceAccumulate", m_ForceAccumulate);
 		out << KEYVAL("TorqueAccumulate", m_TorqueAccumulate);
 		out << KEYVAL("Acceleration", m_Acceleration);
+		out << KEYVAL("ContinuousCollision", m_Continuous);
 //		out << KEYVAL("IsAwake", m_IsAwake);
 		out << KEYVAL("Disable", entity.HasComponent<DisableRigidbody>());
 	}
 
+	void RigidbodyComponent::DeserializeComponent(BinaryReader& reader, Entity entity)
+	{
+		VXM_PROFILE_FUNCTION();
+		reader.Read(m_InverseMass);
+		reader.Read(m_LinearDamping);
+		reader.Read(m_AngularDamping);
+		reader.Read(m_LinearVelocity);
+		reader.Read(m_AngularVelocity);
+		reader.Read(m_InverseInertiaTensor);
+		InvalidateInertiaCache();
+		reader.Read(m_ForceAccumulate);
+		reader.Read(m_TorqueAccumulate);
+		reader.Read(m_Acceleration);
+		m_Continuous = reader.Read<uint8_t>() != 0;
+
+		if(reader.Read<uint8_t>() != 0 && !entity.HasComponent<DisableRigidbody>())
+		{
+			entity.AddEmptyComponent<DisableRigidbody>();
+		}
+
+		if (!m_Transform)
+		{
+			m_Transform = &entity.GetComponent<TransformComponent>();
+		}
+	}
+
+	void RigidbodyComponent::SerializeComponent(BinaryWriter& writer, Entity entity)
+	{
+		VXM_PROFILE_FUNCTION();
+		writer.Write(m_InverseMass);
+		writer.Write(m_LinearDamping);
+		writer.Write(m_AngularDamping);
+		writer.Write(m_LinearVelocity);
+		writer.Write(m_AngularVelocity);
+		writer.Write(m_InverseInertiaTensor);
+		writer.Write(m_ForceAccumulate);
+		writer.Write(m_TorqueAccumulate);
+		writer.Write(m_Acceleration);
+		writer.Write<uint8_t>(m_Continuous);
+		writer.Write<uint8_t>(entity.HasComponent<DisableRigidbody>());
+	}
+
 	bool RigidbodyComponent::OnImGuiRender(Entity entity)
 	{
 		VXM_PROFILE_FUNCTION();
@@ -121,7 +166,7 @@ namespace Voxymore::Core
 		if(tensorChanged)
 		{
 			changed = true;
-			m_InverseInertiaTensor = glm::inverse(tensor);
+			SetInverseInertiaTensor(glm::inverse(tensor));
 		}
 
 		ImGui::Spacing();
@@ -130,6 +175,11 @@ namespace Voxymore::Core
 		ImGui::Spacing();
 		changed |= ImGuiLib::DragReal3("Acceleration", glm::value_ptr(m_Acceleration));
 		ImGui::Spacing();
+		changed |= ImGui::Checkbox("Continuous Collision", &m_Continuous);
+		if(ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("Sweep the movement of the body against the other colliders so it doesn't pass through them when moving fast.");
+		}
 //		changed |= ImGui::Checkbox("IsAwake", &m_IsAwake);
 
 		if(ImGui::CollapsingHeader("Inertia Tensors"))
@@ -161,7 +211,7 @@ namespace Voxymore::Core
 							tensor[2][2] = constant * (size.x * size.x + size.y * size.y);
 
 							changed = true;
-							m_InverseInertiaTensor = glm::inverse(tensor);
+							SetInverseInertiaTensor(glm::inverse(tensor));
 						}
 						break;
 					}
@@ -177,7 +227,7 @@ namespace Voxymore::Core
 							tensor[2][2] = constant;
 
 							changed = true;
-							m_InverseInertiaTensor = glm::inverse(tensor);
+							SetInverseInertiaTensor(glm::inverse(tensor));
 						}
 						break;
 					}
@@ -193,7 +243,7 @@ namespace Voxymore::Core
 							tensor[2][2] = constant;
 
 							changed = true;
-							m_InverseInertiaTensor = glm::inverse(tensor);
+							SetInverseInertiaTensor(glm::inverse(tensor));
 						}
 						break;
 					}
@@ -209,7 +259,7 @@ namespace Voxymore::Core
 							tensor[2][2] = constant * (rad.x * rad.x + rad.y * rad.y);
 
 							changed = true;
-							m_InverseInertiaTensor = glm::inverse(tensor);
+							SetInverseInertiaTensor(glm::inverse(tensor));
 						}
 						break;
 					}
@@ -227,7 +277,7 @@ namespace Voxymore::Core
 							tensor[2][2] = constantC + constantS;
 
 							changed = true;
-							m_InverseInertiaTensor = glm::inverse(tensor);
+							SetInverseInertiaTensor(glm::inverse(tensor));
 						}
 						break;
 					}
@@ -246,7 +296,7 @@ namespace Voxymore::Core
 							tensor[2][2] = ((Real)(3./5.) * mass * height2) + ((Real)(3./20.) * mass * radius2);
 
 							changed = true;
-							m_InverseInertiaTensor = glm::inverse(tensor);
+							SetInverseInertiaTensor(glm::inverse(tensor));
 						}
 						break;
 					}
@@ -0,0 +1,125 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/Components/RigidbodyJointComponent.hpp"
+#include "Voxymore/ImGui/ImGuiLib.hpp"
+#include "Voxymore/Utils/Platform.hpp"
+
+namespace Voxymore::Core
+{
+	void RigidbodyJointComponent::DeserializeComponent(YAML::Node& node)
+	{
+		VXM_PROFILE_FUNCTION();
+		Type = (JointType) node["Type"].as<int>((int)VXM_DEFAULT_JOINT_TYPE);
+		UUID scene = node["ConnectedSceneId"].as<uint64_t>(0);
+		UUID entity = node["ConnectedEntityId"].as<uint64_t>(0);
+		ConnectedEntity = EntityField(entity, scene);
+		ConnectedEntityName = node["ConnectedEntityName"].as<std::string>("");
+		LocalAnchor = node["LocalAnchor"].as<Vec3>(Vec3(0));
+		ConnectedAnchor = node["ConnectedAnchor"].as<Vec3>(Vec3(0));
+		Axis = node["Axis"].as<Vec3>(VXM_DEFAULT_JOINT_AXIS);
+		ConnectedAxis = node["ConnectedAxis"].as<Vec3>(VXM_DEFAULT_JOINT_AXIS);
+		Length = node["Length"].as<Real>(VXM_DEFAULT_JOINT_LENGTH);
+	}
+
+	void RigidbodyJointComponent::SerializeComponent(YAML::Emitter& out)
+	{
+		VXM_PROFILE_FUNCTION();
+		out << KEYVAL("Type", (int)Type);
+		out << KEYVAL("ConnectedSceneId", ConnectedEntity.SceneId);
+		out << KEYVAL("ConnectedEntityId", ConnectedEntity.EntityId);
+		out << KEYVAL("ConnectedEntityName", ConnectedEntityName);
+		out << KEYVAL("LocalAnchor", LocalAnchor);
+		out << KEYVAL("ConnectedAnchor", ConnectedAnchor);
+		out << KEYVAL("Axis", Axis);
+		out << KEYVAL("ConnectedAxis", ConnectedAxis);
+		out << KEYVAL("Length", Length);
+	}
+
+	bool RigidbodyJointComponent::OnImGuiRender()
+	{
+		VXM_PROFILE_FUNCTION();
+		bool changed = false;
+		const char* elems[4] = {"Distance", "Ball Socket", "Hinge", "Rope"};
+		changed |= ImGui::Combo("Type", (int*)&Type, elems, 4);
+		if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+		{
+			ImGui::SetTooltip("Distance: the anchors stay at the same distance.\n"
+							  "Ball Socket: the anchors stay together.\n"
+							  "Hinge: the anchors stay together and the bodies only rotate around the axis.\n"
+							  "Rope: the anchors cannot be further apart than the length.");
+		}
+
+		// The clipboard holds the entity copied in the hierarchy as "scene,entity,name".
+		std::string clipContent = Clipboard::Get();
+		uint64_t indexSceneEntity = clipContent.find(',');
+		bool clipContentValid = indexSceneEntity != std::string::npos;
+		EntityField clipEntity;
+		std::string entityName;
+		if(clipContentValid)
+		{
+			try {
+				std::string scene = clipContent.substr(0, indexSceneEntity);
+				std::string entity = clipContent.substr(indexSceneEntity + 1, clipContent.size() - (indexSceneEntity + 2));
+
+				uint64_t indexEntityName = entity.find(',');
+				if(indexEntityName != std::string::npos)
+				{
+					entityName = entity.substr(indexEntityName + 1, entity.size() - (indexEntityName + 2));
+					entity = entity.substr(0, indexEntityName);
+					entityName += " - (" + entity + ")";
+				}
+				else
+				{
+					entityName = entity;
+				}
+
+				UUID sceneId = std::strtoull(scene.c_str(), nullptr, 10);
+				UUID entityId = std::strtoull(entity.c_str(), nullptr, 10);
+				clipEntity = EntityField(entityId, sceneId);
+			}
+			catch (...) {
+				VXM_CORE_ERROR("No valid entity in cliboard.");
+				clipContentValid = false;
+			}
+		}
+
+		ImGui::Text("Connected: %s", HasConnectedEntity() ? ConnectedEntityName.c_str() : "World");
+		ImGui::BeginDisabled(!clipContentValid);
+		if(ImGui::Button("Connect Copied Entity"))
+		{
+			ConnectedEntity = clipEntity;
+			ConnectedEntityName = entityName;
+			changed = true;
+		}
+		ImGui::EndDisabled();
+		ImGui::SameLine();
+		ImGui::BeginDisabled(!HasConnectedEntity());
+		if(ImGui::Button("Connect To World"))
+		{
+			ConnectedEntity = EntityField(UUID(0), UUID(0));
+			ConnectedEntityName.clear();
+			changed = true;
+		}
+		ImGui::EndDisabled();
+
+		changed |= ImGuiLib::DragReal3("Local Anchor", glm::value_ptr(LocalAnchor), 0.01);
+		changed |= ImGuiLib::DragReal3("Connected Anchor", glm::value_ptr(ConnectedAnchor), 0.01);
+		if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+		{
+			ImGui::SetTooltip("In the local space of the connected entity, or in world space when connected to the world.");
+		}
+
+		ImGui::BeginDisabled(Type != JointType::Hinge);
+		changed |= ImGuiLib::DragReal3("Axis", glm::value_ptr(Axis), 0.01);
+		changed |= ImGuiLib::DragReal3("Connected Axis", glm::value_ptr(ConnectedAxis), 0.01);
+		ImGui::EndDisabled();
+
+		ImGui::BeginDisabled(Type != JointType::Distance && Type != JointType::Rope);
+		changed |= ImGuiLib::DragReal("Length", &Length, 0.01, 0, REAL_MAX, "%.2f");
+		ImGui::EndDisabled();
+
+		return changed;
+	}
+} // namespace Voxymore::Core
@@ -0,0 +1,66 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/Components/RigidbodyWorldComponent.hpp"
+#include "Voxymore/ImGui/ImGuiLib.hpp"
+
+namespace Voxymore::Core
+{
+	void RigidbodyWorldComponent::DeserializeComponent(YAML::Node& node)
+	{
+		VXM_PROFILE_FUNCTION();
+		BroadPhaseAlgorithm = (BroadPhaseType) node["BroadPhase"].as<int>((int)VXM_DEFAULT_BROADPHASE);
+		SolverIterations = node["SolverIterations"].as<int>(VXM_DEFAULT_SOLVER_ITERATIONS);
+		WarmStarting = node["WarmStarting"].as<bool>(VXM_DEFAULT_WARM_STARTING);
+		FixedDeltaTime = node["FixedDeltaTime"].as<Real>(VXM_DEFAULT_FIXED_DELTA_TIME);
+		MaxSubSteps = node["MaxSubSteps"].as<int>(VXM_DEFAULT_MAX_SUB_STEPS);
+		Interpolate = node["Interpolate"].as<bool>(VXM_DEFAULT_PHYSICS_INTERPOLATION);
+		AllowSleeping = node["AllowSleeping"].as<bool>(VXM_DEFAULT_ALLOW_SLEEPING);
+		SleepLinearVelocity = node["SleepLinearVelocity"].as<Real>(VXM_DEFAULT_SLEEP_LINEAR_VELOCITY);
+		SleepAngularVelocity = node["SleepAngularVelocity"].as<Real>(VXM_DEFAULT_SLEEP_ANGULAR_VELOCITY);
+		TimeToSleep = node["TimeToSleep"].as<Real>(VXM_DEFAULT_TIME_TO_SLEEP);
+	}
+
+	void RigidbodyWorldComponent::SerializeComponent(YAML::Emitter& out)
+	{
+		VXM_PROFILE_FUNCTION();
+		out << KEYVAL("BroadPhase", (int)BroadPhaseAlgorithm);
+		out << KEYVAL("SolverIterations", SolverIterations);
+		out << KEYVAL("WarmStarting", WarmStarting);
+		out << KEYVAL("FixedDeltaTime", FixedDeltaTime);
+		out << KEYVAL("MaxSubSteps", MaxSubSteps);
+		out << KEYVAL("Interpolate", Interpolate);
+		out << KEYVAL("AllowSleeping", AllowSleeping);
+		out << KEYVAL("SleepLinearVelocity", SleepLinearVelocity);
+		out << KEYVAL("SleepAngularVelocity", SleepAngularVelocity);
+		out << KEYVAL("TimeToSleep", TimeToSleep);
+	}
+
+	bool RigidbodyWorldComponent::OnImGuiRender()
+	{
+		VXM_PROFILE_FUNCTION();
+		bool changed = false;
+		const char* elems[2] = {"Dynamic BVH", "Sweep And Prune"};
+		changed |= ImGui::Combo("Broad Phase", (int*)&BroadPhaseAlgorithm, elems, 2);
+		if(ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+		{
+			ImGui::SetTooltip("The algorithm used to find the potential contacts.\n"
+							  "Sweep And Prune works best when the bodies are spread along one or two axes.\n"
+							  "The change is applied when the scene is (re)started.");
+		}
+		changed |= ImGui::DragInt("Solver Iterations", &SolverIterations, 1, 1, INT_MAX);
+		changed |= ImGui::Checkbox("Warm Starting", &WarmStarting);
+		changed |= ImGuiLib::DragReal("Fixed Delta Time", &FixedDeltaTime, 0.001, 0.001, 1);
+		changed |= ImGui::DragInt("Max Sub Steps", &MaxSubSteps, 1, 1, INT_MAX);
+		changed |= ImGui::Checkbox("Interpolate", &Interpolate);
+		changed |= ImGui::Checkbox("Allow Sleeping", &AllowSleeping);
+		if(AllowSleeping)
+		{
+			changed |= ImGuiLib::DragReal("Sleep Linear Velocity", &SleepLinearVelocity, 0.01, 0, REAL_MAX);
+			changed |= ImGuiLib::DragReal("Sleep Angular Velocity", &SleepAngularVelocity, 0.1, 0, REAL_MAX);
+			changed |= ImGuiLib::DragReal("Time To Sleep", &TimeToSleep, 0.01, 0, REAL_MAX);
+		}
+		return changed;
+	}
+} // namespace Voxymore::Core
@@ -4,6 +4,8 @@
 
 #include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
 #include "Voxymore/RigidbodiesPhysics/Rigidbody.hpp"
+#include <algorithm>
+#include <limits>
 
 
 namespace Voxymore::Core
@@ -29,6 +31,23 @@ namespace Voxymore::Core
 		m_CachedMatrix = m_Transform ? m_Transform->GetTransform() : Math::Identity<Mat4>();
 	}
 
+	Vec3 PrimitiveCollider::Support(const Vec3& direction) const
+	{
+		return GetPosition();
+	}
+
+	bool PrimitiveCollider::GetSupportFace(const Vec3& direction, SupportFace& face) const
+	{
+		return false;
+	}
+
+	Vec3 Sphere::Support(const Vec3& direction) const
+	{
+		const Real length = Math::Magnitude(direction);
+		if(length <= REAL_EPSILON) return GetPosition();
+		return GetPosition() + direction * (m_Radius / length);
+	}
+
 	std::array<Vec3, 8> Box::GetVertices() const
 	{
 		VXM_PROFILE_FUNCTION();
@@ -49,4 +68,227 @@ namespace Voxymore::Core
 
 		return positions;
 	}
+
+	Vec3 Box::Support(const Vec3& direction) const
+	{
+		Vec3 support = GetPosition();
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			const Vec3 axis = GetAxis(i);
+			support += axis * (Math::Dot(axis, direction) >= 0 ? m_HalfSize[i] : -m_HalfSize[i]);
+		}
+		return support;
+	}
+
+	bool Box::GetSupportFace(const Vec3& direction, SupportFace& face) const
+	{
+		VXM_PROFILE_FUNCTION();
+		// The normals are the cross products of the other two axes to stay orthogonal to the faces of a sheared box.
+		int32_t bestAxis = 0;
+		Real bestSign = 1;
+		Real bestDot = -std::numeric_limits<Real>::infinity();
+		Vec3 bestNormal(0);
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			Vec3 normal = Math::Normalize(Math::Cross(GetAxis((i + 1) % 3), GetAxis((i + 2) % 3)));
+			if(Math::Dot(normal, GetAxis(i)) < 0) normal = -normal;
+			const Real dot = Math::Dot(normal, direction);
+			if(Math::Abs(dot) > bestDot)
+			{
+				bestDot = Math::Abs(dot);
+				bestAxis = i;
+				bestSign = dot >= 0 ? (Real)1 : (Real)-1;
+				bestNormal = normal * bestSign;
+			}
+		}
+
+		const int32_t u = (bestAxis + 1) % 3;
+		const int32_t v = (bestAxis + 2) % 3;
+		const std::array<Vec2, 4> corners = {Vec2{1, 1}, Vec2{-1, 1}, Vec2{-1, -1}, Vec2{1, -1}};
+
+		face.normal = bestNormal;
+		face.index = static_cast<uint32_t>(bestAxis) * 2 + (bestSign > 0 ? 1u : 0u);
+		face.points.clear();
+		for (const Vec2& corner : corners)
+		{
+			Vec3 local(0);
+			local[bestAxis] = m_HalfSize[bestAxis] * bestSign;
+			local[u] = m_HalfSize[u] * corner.x;
+			local[v] = m_HalfSize[v] * corner.y;
+			face.points.push_back(Math::TransformPoint(m_CachedMatrix, local));
+		}
+		return true;
+	}
+
+	ConvexHull::ConvexHull()
+	{
+		SetVertices({
+			Vec3{-.5, -.5, -.5}, Vec3{-.5, -.5, +.5}, Vec3{-.5, +.5, -.5}, Vec3{-.5, +.5, +.5},
+			Vec3{+.5, -.5, -.5}, Vec3{+.5, -.5, +.5}, Vec3{+.5, +.5, -.5}, Vec3{+.5, +.5, +.5},
+		});
+	}
+
+	void ConvexHull::SetVertices(std::vector<Vec3> points)
+	{
+		VXM_PROFILE_FUNCTION();
+		ConvexPolyhedron hull;
+		if(QuickHull::Compute(points, hull))
+		{
+			m_Vertices = std::move(hull.vertices);
+			m_Faces = std::move(hull.faces);
+		}
+		else
+		{
+			// The points are on a plane, they are kept as is without the duplicates (i.e. the vertices shared by several triangles of a mesh).
+			std::sort(points.begin(), points.end(), [](const Vec3& a, const Vec3& b) {
+				if(a.x != b.x) return a.x < b.x;
+				if(a.y != b.y) return a.y < b.y;
+				return a.z < b.z;
+			});
+			points.erase(std::unique(points.begin(), points.end()), points.end());
+			m_Vertices = std::move(points);
+			m_Faces.clear();
+		}
+		CacheBounds();
+	}
+
+	void ConvexHull::CacheBounds()
+	{
+		m_LocalMin = m_LocalMax = Vec3(0);
+		m_LocalRadius = 0;
+		m_LocalInnerCenter = Vec3(0);
+		m_LocalInnerRadius = 0;
+		if(m_Vertices.empty()) return;
+
+		m_LocalMin = m_LocalMax = m_Vertices[0];
+		for (const Vec3& vertex : m_Vertices)
+		{
+			m_LocalMin = Math::Min(m_LocalMin, vertex);
+			m_LocalMax = Math::Max(m_LocalMax, vertex);
+		}
+
+		const Vec3 center = (m_LocalMin + m_LocalMax) * (Real)0.5;
+		Real sqrRadius = 0;
+		for (const Vec3& vertex : m_Vertices)
+		{
+			sqrRadius = Math::Max(sqrRadius, Math::SqrMagnitude(vertex - center));
+		}
+		m_LocalRadius = Math::Sqrt(sqrRadius);
+
+		// The center of the bounds can be outside of a skewed hull, the average of the vertices is always inside.
+		for (const Vec3& vertex : m_Vertices)
+		{
+			m_LocalInnerCenter += vertex;
+		}
+		m_LocalInnerCenter /= static_cast<Real>(m_Vertices.size());
+
+		if(m_Faces.empty()) return;
+		m_LocalInnerRadius = REAL_MAX;
+		for (const Face& face : m_Faces)
+		{
+			m_LocalInnerRadius = Math::Min(m_LocalInnerRadius, face.offset - Math::Dot(face.normal, m_LocalInnerCenter));
+		}
+		m_LocalInnerRadius = Math::Max(m_LocalInnerRadius, (Real)0);
+	}
+
+	Vec3 ConvexHull::GetInnerCenter() const
+	{
+		return Math::TransformPoint(m_CachedMatrix, m_LocalInnerCenter);
+	}
+
+	Real ConvexHull::GetInnerRadius() const
+	{
+		// The sphere shrinks with the smallest scale of the transform.
+		Real scale = REAL_MAX;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			scale = Math::Min(scale, Math::Magnitude(GetAxis(i)));
+		}
+		return m_LocalInnerRadius * scale;
+	}
+
+	BoundingBox ConvexHull::GetBoundingBox() const
+	{
+		std::array<Vec3, 8> corners;
+		for (uint32_t i = 0; i < corners.size(); ++i)
+		{
+			const Vec3 local = {(i & 4) ? m_LocalMax.x : m_LocalMin.x, (i & 2) ? m_LocalMax.y : m_LocalMin.y, (i & 1) ? m_LocalMax.z : m_LocalMin.z};
+			corners[i] = Math::TransformPoint(m_CachedMatrix, local);
+		}
+		return BoundingBox(corners);
+	}
+
+	BoundingSphere ConvexHull::GetBoundingSphere() const
+	{
+		// The radius grows with the biggest scale of the transform.
+		Real scale = 0;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			scale = Math::Max(scale, Math::Magnitude(GetAxis(i)));
+		}
+		return BoundingSphere(Math::TransformPoint(m_CachedMatrix, (m_LocalMin + m_LocalMax) * (Real)0.5), m_LocalRadius * scale);
+	}
+
+	std::vector<Vec3> ConvexHull::GetVertices() const
+	{
+		VXM_PROFILE_FUNCTION();
+		std::vector<Vec3> positions(m_Vertices.size());
+		for (uint64_t i = 0; i < m_Vertices.size(); ++i)
+		{
+			positions[i] = Math::TransformPoint(m_CachedMatrix, m_Vertices[i]);
+		}
+		return positions;
+	}
+
+	Vec3 ConvexHull::Support(const Vec3& direction) const
+	{
+		if(m_Vertices.empty()) return GetPosition();
+
+		// dot(M * v, d) = dot(v, transpose(M) * d), so the search is done in local space and only the result is transformed.
+		const Vec3 localDirection = glm::transpose(Mat3(m_CachedMatrix)) * direction;
+		uint64_t best = 0;
+		Real bestDistance = Math::Dot(m_Vertices[0], localDirection);
+		for (uint64_t i = 1; i < m_Vertices.size(); ++i)
+		{
+			const Real distance = Math::Dot(m_Vertices[i], localDirection);
+			if(distance > bestDistance)
+			{
+				bestDistance = distance;
+				best = i;
+			}
+		}
+		return Math::TransformPoint(m_CachedMatrix, m_Vertices[best]);
+	}
+
+	bool ConvexHull::GetSupportFace(const Vec3& direction, SupportFace& face) const
+	{
+		VXM_PROFILE_FUNCTION();
+		if(m_Faces.empty()) return false;
+
+		// The normals are transformed by the inverse transpose to stay orthogonal to the faces of a scaled hull.
+		const Mat3 normalMatrix = glm::transpose(Math::Inverse(Mat3(m_CachedMatrix)));
+		uint64_t best = 0;
+		Real bestDot = -std::numeric_limits<Real>::infinity();
+		Vec3 bestNormal(0);
+		for (uint64_t i = 0; i < m_Faces.size(); ++i)
+		{
+			const Vec3 normal = Math::Normalize(normalMatrix * m_Faces[i].normal);
+			const Real dot = Math::Dot(normal, direction);
+			if(dot > bestDot)
+			{
+				bestDot = dot;
+				best = i;
+				bestNormal = normal;
+			}
+		}
+
+		face.normal = bestNormal;
+		face.index = static_cast<uint32_t>(best);
+		face.points.clear();
+		for (const uint32_t vertex : m_Faces[best].vertices)
+		{
+			face.points.push_back(Math::TransformPoint(m_CachedMatrix, m_Vertices[vertex]));
+		}
+		return true;
+	}
 } // namespace Voxymore::Core
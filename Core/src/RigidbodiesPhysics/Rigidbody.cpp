@@ -16,13 +16,14 @@ namespace Voxymore::Core
 
 		if(!m_Transform) return;
 
-		if(m_InverseMass <= 0) {
+		if(m_InverseMass <= 0 || !m_IsAwake) {
 			return;
 		}
 
 		Vec3 acceleration = m_Acceleration;
 		acceleration += m_ForceAccumulate * m_InverseMass;
-		Vec3 anguarAccel = m_InverseInertiaTensor * m_TorqueAccumulate;
+		// The torques are accumulated in world space.
+		Vec3 anguarAccel = CalculateWorldInverseInertiaTensor() * m_TorqueAccumulate;
 
 		m_LinearVelocity += acceleration * ts;
 		m_AngularVelocity += anguarAccel * ts;
@@ -42,10 +43,9 @@ namespace Voxymore::Core
 		orientation += qua * (Real)0.5;
 		orientation = glm::normalize(orientation);
 		m_Transform->SetRotation(orientation);
-		ClearAccumulator();
 	}
 
-	Mat4 Rigidbody::CalculateTransformMatrix() const
+	const Mat4& Rigidbody::CalculateTransformMatrix() const
 	{
 		VXM_PROFILE_FUNCTION();
 		return m_Transform->GetTransform();
@@ -55,34 +55,40 @@ namespace Voxymore::Core
 	{
 		VXM_PROFILE_FUNCTION();
 		m_InverseInertiaTensor = Math::Inverse(inertiaTensor);
+		InvalidateInertiaCache();
 	}
 
 	void Rigidbody::SetInverseInertiaTensor(const Mat3& inverseInertiaTensor)
 	{
 		VXM_PROFILE_FUNCTION();
 		m_InverseInertiaTensor = inverseInertiaTensor;
+		InvalidateInertiaCache();
 	}
 
-	Mat3 Rigidbody::CalculateWorldInverseInertiaTensor() const
+	const Mat3& Rigidbody::CalculateWorldInverseInertiaTensor() const
 	{
 		VXM_PROFILE_FUNCTION();
-		return Math::ToMat3(m_Transform->GetRotation()) * m_InverseInertiaTensor;
+		if(m_CachedInertiaVersion != m_Transform->GetVersion())
+		{
+			Mat3 rotation = Math::ToMat3(m_Transform->GetRotation());
+			m_CachedWorldInverseInertiaTensor = rotation * m_InverseInertiaTensor * glm::transpose(rotation);
+			m_CachedInertiaVersion = m_Transform->GetVersion();
+		}
+		return m_CachedWorldInverseInertiaTensor;
 	}
 
 	void Rigidbody::AddForce(const Vec3 &force)
 	{
 		VXM_PROFILE_FUNCTION();
+		if(!TryWakeUp(force * m_InverseMass * m_SleepTimeStep, Vec3(0))) return;
 		m_ForceAccumulate += force;
-		// TODO: Add an "awake" mechanism without a bool m_Awake>
-		// m_IsAwake = true;
 	}
 
 	void Rigidbody::AddAcceleration(const Vec3 & accel)
 	{
 		VXM_PROFILE_FUNCTION();
+		if(!TryWakeUp(accel * m_SleepTimeStep, Vec3(0))) return;
 		m_ForceAccumulate += HasFiniteMass() ? accel * GetMass() : accel;
-		// TODO: Add an "awake" mechanism without a bool m_Awake>
-		// m_IsAwake = true;
 	}
 
 
@@ -90,12 +96,12 @@ namespace Voxymore::Core
 	{
 		VXM_PROFILE_FUNCTION();
 		auto r = point - m_Transform->GetPosition();
+		auto torque = Math::Cross(r, force);
+		// The angular acceleration is added as is to the angular velocity by Integrate, so its change is already in degrees per seconds.
+		if(!TryWakeUp(force * m_InverseMass * m_SleepTimeStep, CalculateWorldInverseInertiaTensor() * torque * m_SleepTimeStep)) return;
 
 		m_ForceAccumulate += force;
-		m_TorqueAccumulate += Math::Cross(r, force);
-
-		// TODO: Add an "awake" mechanism without a bool m_Awake>
-		// m_IsAwake = true;
+		m_TorqueAccumulate += torque;
 	}
 
 	void Rigidbody::AddForceAtBodyPoint(const Vec3& force,const Vec3& bodyPoint)
@@ -183,6 +189,7 @@ namespace Voxymore::Core
 
 	void Rigidbody::SetTransform(TransformComponent* transform)
 	{
+		if(m_Transform != transform) InvalidateInertiaCache();
 		m_Transform = transform;
 	}
 
@@ -241,6 +248,7 @@ namespace Voxymore::Core
 	void Rigidbody::SetLinearVelocity(const Vec3& linearVelocity)
 	{
 		VXM_PROFILE_FUNCTION();
+		SetAwake(true);
 		m_LinearVelocity = linearVelocity;
 	}
 	void Rigidbody::AddLinearVelocity(const Vec3& linearVelocity)
@@ -264,6 +272,7 @@ namespace Voxymore::Core
 	void Rigidbody::SetAngularVelocity(const Vec3& angularVelocity)
 	{
 		VXM_PROFILE_FUNCTION();
+		SetAwake(true);
 		m_AngularVelocity = angularVelocity;
 	}
 
@@ -273,4 +282,65 @@ namespace Voxymore::Core
 		m_AngularVelocity += angularVelocity;
 	}
 
-} // namespace Voxymore::Core
\ No newline at end of file
+	bool Rigidbody::IsAwake() const
+	{
+		return m_IsAwake;
+	}
+
+	void Rigidbody::SetAwake(bool awake)
+	{
+		// Waking an awake body must not reset its sleep timer, only its velocity does.
+		if(awake && m_IsAwake) return;
+		m_IsAwake = awake;
+		m_SleepTime = 0;
+		if(!awake)
+		{
+			m_LinearVelocity = Vec3(0);
+			m_AngularVelocity = Vec3(0);
+			ClearAccumulator();
+		}
+	}
+
+	void Rigidbody::UpdateSleepTime(Real ts, Real linearThreshold, Real angularThreshold)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(!m_IsAwake) return;
+
+		m_SleepLinearThreshold = linearThreshold;
+		m_SleepAngularThreshold = angularThreshold;
+		m_SleepTimeStep = ts;
+		if(Math::SqrMagnitude(m_LinearVelocity) < linearThreshold * linearThreshold && Math::SqrMagnitude(m_AngularVelocity) < angularThreshold * angularThreshold)
+		{
+			m_SleepTime += ts;
+		}
+		else
+		{
+			m_SleepTime = 0;
+		}
+	}
+
+	bool Rigidbody::TryWakeUp(const Vec3& linearVelocityChange, const Vec3& angularVelocityChange)
+	{
+		if(m_IsAwake) return true;
+		// Too weak to get the body above the sleep thresholds within a step, it would fall back asleep anyway.
+		if(Math::SqrMagnitude(linearVelocityChange) <= m_SleepLinearThreshold * m_SleepLinearThreshold && Math::SqrMagnitude(angularVelocityChange) <= m_SleepAngularThreshold * m_SleepAngularThreshold) return false;
+		SetAwake(true);
+		return true;
+	}
+
+	Real Rigidbody::GetSleepTime() const
+	{
+		return m_SleepTime;
+	}
+
+	bool Rigidbody::IsContinuous() const
+	{
+		return m_Continuous;
+	}
+
+	void Rigidbody::SetContinuous(bool continuous)
+	{
+		m_Continuous = continuous;
+	}
+
+} // namespace Voxymore::Core
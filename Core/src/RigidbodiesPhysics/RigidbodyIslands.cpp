@@ -0,0 +1,109 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/RigidbodiesPhysics/RigidbodyIslands.hpp"
+
+namespace Voxymore::Core
+{
+	void RigidbodyIslands::AddBody(Rigidbody* body)
+	{
+		VXM_CORE_ASSERT(body, "The body cannot be null.");
+		auto [it, inserted] = m_Indices.emplace(body, static_cast<uint32_t>(m_Bodies.size()));
+		if(!inserted) return;
+		m_Parents.push_back(static_cast<uint32_t>(m_Bodies.size()));
+		m_Bodies.push_back(body);
+	}
+
+	void RigidbodyIslands::Build(const std::vector<RigidbodyContact>& contacts, const std::vector<RigidbodyJoint>& joints)
+	{
+		VXM_PROFILE_FUNCTION();
+		for (const RigidbodyContact& contact : contacts)
+		{
+			Link(contact.bodies[0], contact.bodies[1]);
+		}
+		for (const RigidbodyJoint& joint : joints)
+		{
+			Link(joint.bodies[0], joint.bodies[1]);
+		}
+
+		// Counting sort of the bodies by island.
+		const uint32_t count = static_cast<uint32_t>(m_Bodies.size());
+		std::vector<uint32_t> islandOfRoot(count, UINT32_MAX);
+		std::vector<uint32_t>& islands = m_BodyIslands;
+		islands.resize(count);
+		uint32_t islandCount = 0;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t root = Find(i);
+			if(islandOfRoot[root] == UINT32_MAX) islandOfRoot[root] = islandCount++;
+			islands[i] = islandOfRoot[root];
+		}
+
+		m_IslandOffsets.assign(islandCount + 1, 0);
+		for (uint32_t i = 0; i < count; ++i) ++m_IslandOffsets[islands[i] + 1];
+		for (uint32_t i = 0; i < islandCount; ++i) m_IslandOffsets[i + 1] += m_IslandOffsets[i];
+
+		m_IslandBodies.resize(count);
+		std::vector<uint32_t> cursor(m_IslandOffsets.begin(), m_IslandOffsets.end() - 1);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			m_IslandBodies[cursor[islands[i]]++] = m_Bodies[i];
+		}
+	}
+
+	void RigidbodyIslands::Clear()
+	{
+		m_Bodies.clear();
+		m_Indices.clear();
+		m_Parents.clear();
+		m_BodyIslands.clear();
+		m_IslandBodies.clear();
+		m_IslandOffsets.clear();
+	}
+
+	std::pair<Rigidbody* const*, Rigidbody* const*> RigidbodyIslands::GetIsland(uint32_t island) const
+	{
+		VXM_CORE_ASSERT(island < GetIslandCount(), "The island {0} doesn't exist.", island);
+		return {m_IslandBodies.data() + m_IslandOffsets[island], m_IslandBodies.data() + m_IslandOffsets[island + 1]};
+	}
+
+	uint32_t RigidbodyIslands::GetIslandIndex(const Rigidbody* body) const
+	{
+		auto it = m_Indices.find(body);
+		if(it == m_Indices.end() || it->second >= m_BodyIslands.size()) return UINT32_MAX;
+		return m_BodyIslands[it->second];
+	}
+
+	void RigidbodyIslands::Link(Rigidbody* one, Rigidbody* two)
+	{
+		if(!one || !two) return;
+		if(!one->HasFiniteMass() || !two->HasFiniteMass()) return;
+
+		auto first = m_Indices.find(one);
+		auto second = m_Indices.find(two);
+		if(first == m_Indices.end() || second == m_Indices.end()) return;
+		Union(first->second, second->second);
+	}
+
+	uint32_t RigidbodyIslands::Find(uint32_t body)
+	{
+		while (m_Parents[body] != body)
+		{
+			// Path halving.
+			m_Parents[body] = m_Parents[m_Parents[body]];
+			body = m_Parents[body];
+		}
+		return body;
+	}
+
+	void RigidbodyIslands::Union(uint32_t a, uint32_t b)
+	{
+		a = Find(a);
+		b = Find(b);
+		if(a == b) return;
+		// Keep the smallest index as the root so the islands don't depend on the order of the contacts.
+		if(a < b) m_Parents[b] = a;
+		else m_Parents[a] = b;
+	}
+} // namespace Voxymore::Core
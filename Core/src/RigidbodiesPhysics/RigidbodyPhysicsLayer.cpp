@@ -2,6 +2,7 @@
 // Created by ianpo on 05/01/2024.
 //
 
+#include <chrono>
 #include <utility>
 
 #include "Voxymore/Core/TypeHelpers.hpp"
@@ -11,8 +12,10 @@
 #include "Voxymore/Math/BoundingSphere.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodyFloatingComponent.hpp"
+#include "Voxymore/RigidbodiesPhysics/Components/RigidbodyJointComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/RigidbodySpringComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/Components/ColliderComponent.hpp"
+#include "Voxymore/RigidbodiesPhysics/Components/RigidbodyWorldComponent.hpp"
 #include "Voxymore/RigidbodiesPhysics/RigidbodyPhysicsLayer.hpp"
 #include "Voxymore/RigidbodiesPhysics/Systems/RigidbodyBuoyancySystem.hpp"
 #include "Voxymore/RigidbodiesPhysics/Systems/RigidbodySpringSystem.hpp"
@@ -22,13 +25,36 @@
 
 namespace Voxymore::Core
 {
-	RigidbodyPhysicsLayer::RigidbodyPhysicsLayer() : Layer("RigidbodyPhysicsLayer"), m_Resolver(0), m_Root(new BVHNode<BoundingSphere>(nullptr, nullptr, BoundingSphere()))
+	// Feature of the contacts found by the sweeps, distinct from the features of the discrete tests.
+	static constexpr uint32_t s_ContinuousFeature = UINT32_MAX;
+	// Distance kept between a swept body and the collider it hits, so the discrete test of the same step doesn't add the contact again.
+	static constexpr Real s_ContinuousGap = 1e-3;
+
+	/**
+	 * @brief The key of the manifold of a box pair, made of the full entities (version included) sorted
+	 * so a recycled entity never finds the manifold of the destroyed one and the order of the broadphase doesn't matter.
+	 */
+	static uint64_t GetBoxManifoldKey(const PotentialContact& pc)
+	{
+		uint32_t id0 = entt::to_integral(static_cast<entt::entity>(pc.bodies[0].second));
+		uint32_t id1 = entt::to_integral(static_cast<entt::entity>(pc.bodies[1].second));
+		if(id0 > id1) std::swap(id0, id1);
+		return (static_cast<uint64_t>(id0) << 32) | id1;
+	}
+
+	using StatsClock = std::chrono::steady_clock;
+	static double GetSeconds(StatsClock::time_point begin, StatsClock::time_point end)
+	{
+		return std::chrono::duration<double>(end - begin).count();
+	}
+
+	RigidbodyPhysicsLayer::RigidbodyPhysicsLayer() : Layer("RigidbodyPhysicsLayer"), m_Resolver(VXM_DEFAULT_SOLVER_ITERATIONS), m_BroadPhase(BroadPhase::Create(VXM_DEFAULT_BROADPHASE))
 	{
 	}
 
 	RigidbodyPhysicsLayer::~RigidbodyPhysicsLayer()
 	{
-		delete m_Root;
+		if(HasScene()) DisconnectScene();
 	}
 
 	void RigidbodyPhysicsLayer::OnAttach()
@@ -39,7 +65,9 @@ namespace Voxymore::Core
 		ColliderComponent::RegisterComponent();
 		RigidbodyComponent::RegisterComponent();
 		RigidbodySpringComponent::RegisterComponent();
+		RigidbodyJointComponent::RegisterComponent();
 		RigidbodyFloatingComponent::RegisterComponent();
+		RigidbodyWorldComponent::RegisterComponent();
 	}
 
 	void RigidbodyPhysicsLayer::OnDetach()
@@ -50,13 +78,13 @@ namespace Voxymore::Core
 		ColliderComponent::UnregisterComponent();
 		RigidbodyComponent::UnregisterComponent();
 		RigidbodySpringComponent::UnregisterComponent();
+		RigidbodyJointComponent::UnregisterComponent();
 		RigidbodyFloatingComponent::UnregisterComponent();
+		RigidbodyWorldComponent::UnregisterComponent();
 	}
 
 	void RigidbodyPhysicsLayer::OnUpdate(TimeStep ts)
 	{
-		//TODO: Use a Coherence System to handle object not moving on a ground.
-
 		VXM_PROFILE_FUNCTION();
 
 		if(!HasScene()) {
@@ -67,13 +95,125 @@ namespace Voxymore::Core
 			return;
 		}
 
+		const uint32_t steps = m_FixedTimeStep.Advance(ts);
+		if(m_Interpolate) RestoreTransforms();
+
+		// The forces of the frame are a rate, applied on each of its steps and cleared even when no step is run so they never pile up.
+		for (uint32_t i = 0; i < steps; ++i)
+		{
+			if(m_Interpolate && i + 1 == steps) SavePreviousTransforms();
+			SimulateStep(m_FixedTimeStep.GetFixedDeltaTime());
+		}
+		ClearForces();
+
+		if(m_Interpolate)
+		{
+			if(steps > 0) SaveCurrentTransforms();
+			InterpolateTransforms(m_FixedTimeStep.GetAlpha());
+		}
+	}
+
+	void RigidbodyPhysicsLayer::Simulate(uint32_t stepCount)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(!HasScene()) return;
+
+		if(m_Interpolate) RestoreTransforms();
+
+		for (uint32_t i = 0; i < stepCount; ++i)
+		{
+			SimulateStep(m_FixedTimeStep.GetFixedDeltaTime());
+		}
+		ClearForces();
+
+		if(m_Interpolate)
+		{
+			SaveCurrentTransforms();
+			InterpolateTransforms(1);
+		}
+	}
+
+	void RigidbodyPhysicsLayer::SimulateStep(TimeStep ts)
+	{
+		VXM_PROFILE_FUNCTION();
+		const StatsClock::time_point begin = StatsClock::now();
+		m_Contacts.clear();
+		m_TriggerOverlaps.clear();
+		SaveContinuousStarts();
 		Integrate(ts);
+		const StatsClock::time_point integrated = StatsClock::now();
 
-		if(!BroadCollisionCheck(ts)) return;
+		ContinuousCollisionCheck(ts);
+		const StatsClock::time_point swept = StatsClock::now();
 
-		if(!FineCollisionCheck(ts)) return;
+		const bool hasPairs = BroadCollisionCheck(ts);
+		const StatsClock::time_point broad = StatsClock::now();
+
+		bool hasContacts = hasPairs && FineCollisionCheck(ts);
+		if(!m_ContinuousContacts.empty())
+		{
+			AddContacts(m_ContinuousContacts);
+			hasContacts = true;
+		}
+		const StatsClock::time_point narrow = StatsClock::now();
 
-		CollisionResolution(ts);
+		if(hasContacts) WakeTouchedBodies();
+		BuildJoints();
+
+		BuildIslands();
+		if(hasContacts || !m_Joints.empty()) CollisionResolution(ts);
+
+		UpdateSleeping(ts);
+		const StatsClock::time_point end = StatsClock::now();
+
+		// The sweeps of the continuous bodies are counted with the narrowphase.
+		m_Stats.integrate += GetSeconds(begin, integrated);
+		m_Stats.broadphase += GetSeconds(swept, broad);
+		m_Stats.narrowphase += GetSeconds(integrated, swept) + GetSeconds(broad, narrow);
+		m_Stats.resolve += GetSeconds(narrow, end);
+		m_Stats.steps += 1;
+		m_Stats.potentialContacts += hasPairs ? m_PotentialContacts.size() + m_TriggerPairs.size() : 0;
+		m_Stats.contacts += m_Contacts.size();
+	}
+
+	void RigidbodyPhysicsLayer::RestoreTransforms()
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<RigidbodyComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			m_Snapshots.Restore(e, view.get<TransformComponent>(e));
+		}
+	}
+
+	void RigidbodyPhysicsLayer::SavePreviousTransforms()
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<RigidbodyComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			m_Snapshots.SavePrevious(e, view.get<TransformComponent>(e));
+		}
+	}
+
+	void RigidbodyPhysicsLayer::SaveCurrentTransforms()
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<RigidbodyComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			m_Snapshots.SaveCurrent(e, view.get<TransformComponent>(e));
+		}
+	}
+
+	void RigidbodyPhysicsLayer::InterpolateTransforms(Real alpha)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<RigidbodyComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			m_Snapshots.Interpolate(e, view.get<TransformComponent>(e), alpha);
+		}
 	}
 
 	void RigidbodyPhysicsLayer::Integrate(TimeStep ts)
@@ -89,11 +229,116 @@ namespace Voxymore::Core
 		m_SceneHandle->each<RigidbodyComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>,  MultiThreading::ExecutionPolicy::Parallel, func);
 	}
 
+	void RigidbodyPhysicsLayer::ClearForces()
+	{
+		VXM_PROFILE_FUNCTION();
+		auto view = m_SceneHandle->view<RigidbodyComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			view.get<RigidbodyComponent>(e).ClearAccumulator();
+		}
+	}
+
+	void RigidbodyPhysicsLayer::SaveContinuousStarts()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_ContinuousBodies.clear();
+		auto view = m_SceneHandle->view<RigidbodyComponent, ColliderComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			RigidbodyComponent& rc = view.get<RigidbodyComponent>(e);
+			if(!rc.IsContinuous() || !rc.HasFiniteMass() || !rc.IsAwake()) continue;
+			m_ContinuousBodies.push_back({e, view.get<TransformComponent>(e).GetPosition()});
+		}
+	}
+
+	void RigidbodyPhysicsLayer::ContinuousCollisionCheck(TimeStep ts)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_ContinuousContacts.clear();
+		if(m_ContinuousBodies.empty()) return;
+
+		auto view = m_SceneHandle->view<RigidbodyComponent, ColliderComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (const ContinuousBody& continuous : m_ContinuousBodies)
+		{
+			RigidbodyComponent& rc = view.get<RigidbodyComponent>(continuous.entity);
+			ColliderComponent& cc = view.get<ColliderComponent>(continuous.entity);
+			TransformComponent& tc = view.get<TransformComponent>(continuous.entity);
+			if(cc.m_Filter.isTrigger) continue;
+			cc.SetTransform(&tc);
+			cc.SetRigidbody(&rc);
+
+			// The inner sphere of the collider is swept, the rotation is left to the discrete tests.
+			const Real radius = std::visit([](const auto& collider) { return ContinuousCollisionDetector::GetInnerRadius(collider); }, cc.m_Collider);
+			const Vec3 center = std::visit([](const auto& collider) { return ContinuousCollisionDetector::GetInnerCenter(collider); }, cc.m_Collider);
+			const Vec3 displacement = tc.GetPosition() - continuous.start;
+			const Vec3 start = center - displacement;
+			const Real distance = Math::Magnitude(displacement);
+
+			// A body moving less than its inner radius cannot go through anything the discrete tests would miss.
+			if(radius <= 0 || distance <= radius) continue;
+
+			BoundingBox sweptBox(Math::Min(start, center) - Vec3(radius), Math::Max(start, center) + Vec3(radius));
+
+			TimeOfImpact toi;
+			Rigidbody* hit = nullptr;
+			entt::entity hitEntity = entt::null;
+			auto sweepAgainst = [&](entt::entity other)
+			{
+				// The proxies and the planes are the ones of the previous step, the entity might have been disabled since.
+				if(other == continuous.entity || !view.contains(other)) return;
+				ColliderComponent& target = view.get<ColliderComponent>(other);
+				if(target.m_Filter.isTrigger || !cc.m_Filter.ShouldCollide(target.m_Filter)) return;
+				target.SetTransform(&view.get<TransformComponent>(other));
+				target.SetRigidbody(&view.get<RigidbodyComponent>(other));
+				BoundingBox targetBox = target.GetBoundingBox();
+				// The planes have no bounding box and are always tested.
+				if(targetBox.IsValid() && !targetBox.Overlaps(sweptBox)) return;
+
+				auto sweep = [&](const auto& collider) { return ContinuousCollisionDetector::Sweep(start, radius, displacement, collider, toi); };
+				if(std::visit(sweep, target.m_Collider))
+				{
+					hit = &view.get<RigidbodyComponent>(other);
+					hitEntity = other;
+				}
+			};
+
+			// Only the colliders whose proxy overlaps the swept box can be hit, the planes are not in the broadphase.
+			// The broadphase is updated after this check, so a collider created this step is only swept against from the next one.
+			m_ContinuousCandidates.clear();
+			m_BroadPhase->QueryProxies(sweptBox, m_ContinuousCandidates);
+			for (const std::pair<Rigidbody*, Entity>& candidate : m_ContinuousCandidates)
+			{
+				sweepAgainst(candidate.second);
+			}
+			for (const std::pair<Rigidbody*, Entity>& plane : m_Planes)
+			{
+				sweepAgainst(plane.second);
+			}
+
+			if(!hit) continue;
+
+			// Stop the body at its first impact, the rest of the movement is dropped for this step.
+			const Real time = Math::Max(toi.time - s_ContinuousGap / distance, (Real)0);
+			tc.SetPosition(continuous.start + displacement * time);
+			cc.SetTransform(&tc);
+
+			RigidbodyContact contact;
+			contact.contactPoint = toi.point;
+			contact.contactNormal = toi.normal;
+			contact.penetration = 0;
+			contact.feature = s_ContinuousFeature;
+			contact.SetBodyData(&rc, hit, m_Contacts.friction, m_Contacts.restitution);
+			contact.entities = {continuous.entity, hitEntity};
+			m_ContinuousContacts.push_back(contact);
+		}
+	}
+
 	bool RigidbodyPhysicsLayer::BroadCollisionCheck(TimeStep ts)
 	{
 		VXM_PROFILE_FUNCTION();
-		delete m_Root;
-		m_Root = nullptr;
+		m_Planes.clear();
+		m_MovingProxies.clear();
 		auto view = m_SceneHandle->view<RigidbodyComponent, ColliderComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
 		for (auto e : view)
 		{
@@ -102,68 +347,377 @@ namespace Voxymore::Core
 			ColliderComponent& cc = view.get<ColliderComponent>(e);
 			cc.SetTransform(&tc);
 			cc.SetRigidbody(&rc);
-			if(m_Root) m_Root->Insert(reinterpret_cast<Rigidbody*>(&rc), Entity(e,m_SceneHandle.get()), cc.GetBoundingSphere());
-			else m_Root = new BVHNode<BoundingSphere>(nullptr, reinterpret_cast<Rigidbody*>(&rc), Entity(e,m_SceneHandle.get()), cc.GetBoundingSphere());
+
+			BoundingBox box = cc.GetBoundingBox();
+			auto it = m_Proxies.find(e);
+
+			// Planes don't have a finite bounding box and are never inserted in the broadphase.
+			if(!box.IsValid())
+			{
+				if(it != m_Proxies.end()) OnRemoveProxy(e);
+				if(cc.TryGet<Plane>()) m_Planes.push_back({reinterpret_cast<Rigidbody*>(&rc), Entity(e,m_SceneHandle.get())});
+				continue;
+			}
+
+			const bool isStatic = !rc.HasFiniteMass();
+			if(it == m_Proxies.end())
+			{
+				// A flat hull has no inner sphere to sweep.
+				const ConvexHull* hull = cc.TryGet<ConvexHull>();
+				if(rc.IsContinuous() && hull && hull->GetFaces().empty())
+				{
+					VXM_CORE_WARN("The entity {0} is continuous but its convex hull is flat, it will only be tested by the discrete collisions.", static_cast<uint32_t>(e));
+				}
+				it = m_Proxies.emplace(e, m_BroadPhase->CreateProxy(box, reinterpret_cast<Rigidbody*>(&rc), Entity(e,m_SceneHandle.get()), cc.m_Filter, isStatic)).first;
+			}
+			else
+			{
+				// The components might have been moved in memory by the registry since the last frame.
+				m_BroadPhase->SetProxyBody(it->second, reinterpret_cast<Rigidbody*>(&rc));
+				m_BroadPhase->SetProxyFilter(it->second, cc.m_Filter);
+				m_BroadPhase->SetProxyStatic(it->second, isStatic);
+				// A sleeping body is not integrated but its transform can still be written directly (i.e. by the editor or a script),
+				// its proxy is updated as well and the body is woken up when it left its fat box.
+				const Vec3 displacement = rc.IsAwake() ? rc.GetLinearVelocity() * (Real)ts.GetSeconds() : Vec3(0);
+				if(m_BroadPhase->MoveProxy(it->second, box, displacement) && !isStatic && !rc.IsAwake()) rc.SetAwake(true);
+			}
+
+			if(!isStatic && rc.IsAwake()) m_MovingProxies.push_back({{reinterpret_cast<Rigidbody*>(&rc), Entity(e,m_SceneHandle.get())}, it->second});
 		}
 
-		if(!m_Root)
+		if(m_BroadPhase->GetProxyCount() == 0)
 		{
 			VXM_CORE_WARN("No rigidbodies found in the scene.");
 			return false;
 		}
 
 		m_PotentialContacts.clear();
-		m_PotentialContacts.reserve(view.size_hint());
-		m_Root->GetPotentialContacts(m_PotentialContacts);
-		return !m_PotentialContacts.empty();
+		m_BroadPhase->GetPotentialContacts(m_PotentialContacts);
+		PlaneCollisionCheck();
+
+		// Nothing can change between bodies that are all sleeping or static.
+		auto isSimulated = [](const Rigidbody* body) { return body && body->HasFiniteMass() && body->IsAwake(); };
+		std::erase_if(m_PotentialContacts, [&isSimulated](const PotentialContact& pc) {
+			return !isSimulated(pc.bodies[0].first) && !isSimulated(pc.bodies[1].first);
+		});
+
+		// The trigger pairs never create contacts, they are moved aside to only be tested for overlap.
+		m_TriggerPairs.clear();
+		for (const PotentialContact& pc : m_PotentialContacts)
+		{
+			if(pc.isTrigger) m_TriggerPairs.push_back(pc);
+		}
+		std::erase_if(m_PotentialContacts, [](const PotentialContact& pc) { return pc.isTrigger; });
+		return !m_PotentialContacts.empty() || !m_TriggerPairs.empty();
+	}
+
+	void RigidbodyPhysicsLayer::PlaneCollisionCheck()
+	{
+		VXM_PROFILE_FUNCTION();
+		for (auto& plane : m_Planes)
+		{
+			const ColliderComponent& planeCollider = plane.second.GetComponent<ColliderComponent>();
+			const Plane& p = planeCollider.Get<Plane>();
+			for (MovingProxy& moving : m_MovingProxies)
+			{
+				const ColliderComponent& collider = moving.body.second.GetComponent<ColliderComponent>();
+				if(!collider.m_Filter.ShouldCollide(planeCollider.m_Filter)) continue;
+				if(!IntersectionDetector::BoundingBoxAndHalfSpace(m_BroadPhase->GetFatBoundingBox(moving.proxy), p)) continue;
+				m_PotentialContacts.push_back({{moving.body, plane}, collider.m_Filter.isTrigger || planeCollider.m_Filter.isTrigger});
+			}
+		}
 	}
 
 	bool RigidbodyPhysicsLayer::FineCollisionCheck(TimeStep ts)
 	{
 		VXM_PROFILE_FUNCTION();
 		m_Contacts.clear();
-		m_Contacts.reserve(m_PotentialContacts.size());
-		CollisionData* contacts = &m_Contacts;
+		TriggerCheck();
+		if(m_PotentialContacts.empty()) return false;
 
-		for (PotentialContact& potentialContact : m_PotentialContacts)
-		{
-			auto&& [body0, entity0] = potentialContact.bodies[0];
-			auto& col0 = entity0.GetComponent<ColliderComponent>();
+		CullBoxPairs();
+		if(m_PotentialContacts.empty()) return false;
 
-			auto&& [body1, entity1] = potentialContact.bodies[1];
-			auto& col1 = entity1.GetComponent<ColliderComponent>();
+		// The pairs are split in contiguous chunks, each one filling its own buffer, and the buffers are merged in the chunk order.
+		// The contacts are therefore in the same order as a sequential run, whatever the number of threads.
+		UpdateManifolds();
 
-			auto bb = [&contacts](Box& one, Box& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto bs = [&contacts](Box& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto bp = [&contacts](Box& one, Plane& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto sb = [&contacts](Sphere& one, Box& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto ss = [&contacts](Sphere& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto sp = [&contacts](Sphere& one, Plane& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto pb = [&contacts](Plane& one, Box& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto ps = [&contacts](Plane& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
-			auto pp = [](Plane& one, Plane& two){ return 0u;};
+		const size_t pairCount = m_PotentialContacts.size();
+		const size_t chunkCount = std::min<size_t>(pairCount, std::max<size_t>(1, thread_count() * 4));
+		const size_t chunkSize = (pairCount + chunkCount - 1) / chunkCount;
+		m_ContactsBuffers.resize(chunkCount);
 
-			auto collisionPoints = std::visit(overloads{bb, bs, bp, sb, ss, sp, pb, ps, pp}, col0.m_Collider, col1.m_Collider);
+		auto func = [this, chunkSize, pairCount](CollisionData& buffer)
+		{
+			const size_t chunk = &buffer - m_ContactsBuffers.data();
+			const size_t begin = chunk * chunkSize;
+			const size_t end = std::min(begin + chunkSize, pairCount);
+
+			buffer.clear();
+			buffer.friction = m_Contacts.friction;
+			buffer.restitution = m_Contacts.restitution;
+			for (size_t i = begin; i < end; ++i)
+			{
+				Collide(m_PotentialContacts[i], &buffer, m_PairManifolds[i]);
+			}
+		};
+		MultiThreading::for_each(MultiThreading::ExecutionPolicy::Parallel, m_ContactsBuffers.begin(), m_ContactsBuffers.end(), func);
+
+		{
+			VXM_PROFILE_SCOPE("RigidbodyPhysicsLayer::FineCollisionCheck - Merge");
+			size_t count = 0;
+			for (const CollisionData& buffer : m_ContactsBuffers) count += buffer.size();
+			m_Contacts.reserve(count);
+			for (const CollisionData& buffer : m_ContactsBuffers)
+			{
+				m_Contacts.contacts.insert(m_Contacts.end(), buffer.contacts.begin(), buffer.contacts.end());
+			}
 		}
 
 		return !m_Contacts.empty();
 	}
 
+	void RigidbodyPhysicsLayer::TriggerCheck()
+	{
+		VXM_PROFILE_FUNCTION();
+		for (PotentialContact& pc : m_TriggerPairs)
+		{
+			m_TriggerContacts.clear();
+			Collide(pc, &m_TriggerContacts, nullptr);
+			if(!m_TriggerContacts.empty()) m_TriggerOverlaps.push_back(pc);
+		}
+	}
+
+	void RigidbodyPhysicsLayer::CullBoxPairs()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_BoxOverlaps.Clear();
+		m_BoxOverlapPairs.clear();
+		for (uint32_t i = 0; i < m_PotentialContacts.size(); ++i)
+		{
+			auto& col0 = m_PotentialContacts[i].bodies[0].second.GetComponent<ColliderComponent>();
+			auto& col1 = m_PotentialContacts[i].bodies[1].second.GetComponent<ColliderComponent>();
+			const Box* one = col0.TryGet<Box>();
+			const Box* two = col1.TryGet<Box>();
+			if(!one || !two) continue;
+			// The pairs already tested last step keep their manifold, whose cached separating axis is cheaper than the batch.
+			if(m_BoxManifolds.contains(GetBoxManifoldKey(m_PotentialContacts[i]))) continue;
+			m_BoxOverlaps.Add(*one, *two);
+			m_BoxOverlapPairs.push_back(i);
+		}
+		if(m_BoxOverlaps.empty()) return;
+
+		const std::vector<uint8_t>& overlaps = m_BoxOverlaps.Test();
+
+		// Remove the separated pairs in place, keeping the order of the others.
+		size_t write = 0;
+		size_t batchIndex = 0;
+		for (uint32_t i = 0; i < m_PotentialContacts.size(); ++i)
+		{
+			if(batchIndex < m_BoxOverlapPairs.size() && m_BoxOverlapPairs[batchIndex] == i)
+			{
+				if(!overlaps[batchIndex++]) continue;
+			}
+			if(write != i) m_PotentialContacts[write] = std::move(m_PotentialContacts[i]);
+			++write;
+		}
+		m_PotentialContacts.resize(write);
+	}
+
+	void RigidbodyPhysicsLayer::UpdateManifolds()
+	{
+		VXM_PROFILE_FUNCTION();
+		const uint64_t step = ++m_ManifoldStep;
+		m_PairManifolds.resize(m_PotentialContacts.size());
+		for (size_t i = 0; i < m_PotentialContacts.size(); ++i)
+		{
+			PotentialContact& pc = m_PotentialContacts[i];
+			m_PairManifolds[i] = nullptr;
+			if(!pc.bodies[0].second.GetComponent<ColliderComponent>().TryGet<Box>() || !pc.bodies[1].second.GetComponent<ColliderComponent>().TryGet<Box>()) continue;
+
+			// The manifold is expressed in the space of the first box, so the pair is always tested in the same order whatever the order of the broadphase.
+			if(entt::to_integral(static_cast<entt::entity>(pc.bodies[0].second)) > entt::to_integral(static_cast<entt::entity>(pc.bodies[1].second)))
+			{
+				std::swap(pc.bodies[0], pc.bodies[1]);
+			}
+
+			// Created here, on the main thread, so the narrowphase only touches the manifold of its own pair.
+			BoxManifold& manifold = m_BoxManifolds[GetBoxManifoldKey(pc)];
+			manifold.lastStep = step;
+			m_PairManifolds[i] = &manifold;
+		}
+
+		std::erase_if(m_BoxManifolds, [step](const auto& pair) { return pair.second.lastStep != step; });
+	}
+
+	void RigidbodyPhysicsLayer::Collide(PotentialContact& potentialContact, CollisionData* contacts, BoxManifold* manifold)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto&& [body0, entity0] = potentialContact.bodies[0];
+		auto& col0 = entity0.GetComponent<ColliderComponent>();
+
+		auto&& [body1, entity1] = potentialContact.bodies[1];
+		auto& col1 = entity1.GetComponent<ColliderComponent>();
+
+		auto bb = [&contacts, manifold](Box& one, Box& two){ return manifold ? CollisionDetector::Collide(one,two,contacts,*manifold) : CollisionDetector::Collide(one,two,contacts);};
+		auto bs = [&contacts](Box& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto bp = [&contacts](Box& one, Plane& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto sb = [&contacts](Sphere& one, Box& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto ss = [&contacts](Sphere& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto sp = [&contacts](Sphere& one, Plane& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto pb = [&contacts](Plane& one, Box& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto ps = [&contacts](Plane& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto pp = [](Plane& one, Plane& two){ return 0u;};
+		auto hh = [&contacts](ConvexHull& one, ConvexHull& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto hb = [&contacts](ConvexHull& one, Box& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto hs = [&contacts](ConvexHull& one, Sphere& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto hp = [&contacts](ConvexHull& one, Plane& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto bh = [&contacts](Box& one, ConvexHull& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto sh = [&contacts](Sphere& one, ConvexHull& two){ return CollisionDetector::Collide(one,two,contacts);};
+		auto ph = [&contacts](Plane& one, ConvexHull& two){ return CollisionDetector::Collide(one,two,contacts);};
+
+		const size_t first = contacts->size();
+		auto collisionPoints = std::visit(overloads{bb, bs, bp, sb, ss, sp, pb, ps, pp, hh, hb, hs, hp, bh, sh, ph}, col0.m_Collider, col1.m_Collider);
+
+		// The detectors only know the bodies and might have swapped them, the entities follow the same order.
+		for (size_t i = first; i < contacts->size(); ++i)
+		{
+			RigidbodyContact& contact = contacts->contacts[i];
+			const bool swapped = (body1 && contact.bodies[0] == body1) || (body0 && contact.bodies[1] == body0);
+			contact.entities = swapped ? std::array<entt::entity, 2>{entity1, entity0} : std::array<entt::entity, 2>{entity0, entity1};
+		}
+	}
+
 	void RigidbodyPhysicsLayer::CollisionResolution(TimeStep ts)
 	{
 		VXM_PROFILE_FUNCTION();
-		if(!m_Contacts.empty())
+		if(!m_Contacts.empty() || !m_Joints.empty())
+		{
+			m_Resolver.ResolveContacts(ts, m_Contacts.contacts, m_Joints, m_Islands, JobSystem::Get());
+		}
+	}
+
+	void RigidbodyPhysicsLayer::WakeTouchedBodies()
+	{
+		VXM_PROFILE_FUNCTION();
+		// A sleeping body touched by an awake one must react to the contact.
+		for (const RigidbodyContact& contact : m_Contacts.contacts)
+		{
+			Rigidbody* one = contact.bodies[0];
+			Rigidbody* two = contact.bodies[1];
+			if(!one || !two) continue;
+			if(!one->HasFiniteMass() || !two->HasFiniteMass()) continue;
+			if(one->IsAwake() != two->IsAwake())
+			{
+				one->SetAwake(true);
+				two->SetAwake(true);
+			}
+		}
+	}
+
+	void RigidbodyPhysicsLayer::BuildJoints()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Joints.clear();
+		auto view = m_SceneHandle->view<RigidbodyJointComponent, RigidbodyComponent, TransformComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			auto [jc, rc, tc] = view.get<RigidbodyJointComponent, RigidbodyComponent, TransformComponent>(e);
+
+			RigidbodyJoint joint;
+			joint.type = jc.Type;
+			joint.length = jc.Length;
+			joint.bodies[0] = &rc;
+			joint.entities[0] = e;
+			joint.anchors[0] = tc.GetWorldPoint(jc.LocalAnchor);
+			joint.axes[0] = Math::Normalize(tc.GetRotation() * jc.Axis);
+			joint.anchors[1] = jc.ConnectedAnchor;
+			joint.axes[1] = Math::Normalize(jc.ConnectedAxis);
+
+			if(jc.HasConnectedEntity())
+			{
+				Entity connected = jc.ConnectedEntity.GetEntity(*m_SceneHandle);
+				if(!connected || !connected.HasComponent<TransformComponent>()) continue;
+				const TransformComponent& ctc = connected.GetComponent<TransformComponent>();
+				joint.anchors[1] = ctc.GetWorldPoint(jc.ConnectedAnchor);
+				joint.axes[1] = Math::Normalize(ctc.GetRotation() * jc.ConnectedAxis);
+				// An entity without a simulated rigidbody is a fixed point.
+				if(connected.HasComponent<RigidbodyComponent>() && !connected.HasComponent<DisableComponent>() && !connected.HasComponent<DisableRigidbody>())
+				{
+					joint.bodies[1] = &connected.GetComponent<RigidbodyComponent>();
+					joint.entities[1] = connected;
+				}
+			}
+
+			Rigidbody* other = joint.bodies[1];
+			const bool firstAwake = rc.HasFiniteMass() && rc.IsAwake();
+			const bool secondAwake = other && other->HasFiniteMass() && other->IsAwake();
+			// Two sleeping bodies stay where the joint left them.
+			if(!firstAwake && !secondAwake) continue;
+			if(rc.HasFiniteMass() && !firstAwake) rc.SetAwake(true);
+			if(other && other->HasFiniteMass() && !secondAwake) other->SetAwake(true);
+
+			m_Joints.push_back(joint);
+		}
+	}
+
+	void RigidbodyPhysicsLayer::BuildIslands()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Islands.Clear();
+		auto view = m_SceneHandle->view<RigidbodyComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
 		{
-			VXM_CORE_INFO("Resolve {0} contacts with maximum {1} iterations.",m_Contacts.size() , m_Contacts.size() * 2);
-			m_Resolver.SetIterations(m_Contacts.size() * 2);
-			m_Resolver.ResolveContacts(ts, m_Contacts.contacts);
+			RigidbodyComponent& rc = view.get<RigidbodyComponent>(e);
+			if(rc.HasFiniteMass()) m_Islands.AddBody(&rc);
+		}
+		m_Islands.Build(m_Contacts.contacts, m_Joints);
+	}
+
+	void RigidbodyPhysicsLayer::UpdateSleeping(TimeStep ts)
+	{
+		VXM_PROFILE_FUNCTION();
+		if(!m_AllowSleeping) return;
+
+		auto view = m_SceneHandle->view<RigidbodyComponent>(exclude<DisableComponent, DisableRigidbody>);
+		for (auto e : view)
+		{
+			RigidbodyComponent& rc = view.get<RigidbodyComponent>(e);
+			if(rc.HasFiniteMass() && rc.IsAwake()) rc.UpdateSleepTime(ts, m_SleepLinearVelocity, m_SleepAngularVelocity);
+		}
+
+		// An island sleeps only as a whole, otherwise the bodies resting on a sleeping one would fall through it.
+		for (uint32_t i = 0; i < m_Islands.GetIslandCount(); ++i)
+		{
+			auto [begin, end] = m_Islands.GetIsland(i);
+			bool canSleep = true;
+			bool hasAwakeBody = false;
+			for (auto it = begin; it != end && canSleep; ++it)
+			{
+				if(!(*it)->IsAwake()) continue;
+				hasAwakeBody = true;
+				canSleep = (*it)->GetSleepTime() >= m_TimeToSleep;
+			}
+			if(!canSleep || !hasAwakeBody) continue;
+
+			for (auto it = begin; it != end; ++it)
+			{
+				(*it)->SetAwake(false);
+			}
 		}
 	}
 
 	void RigidbodyPhysicsLayer::SetScene(Ref<Scene> scene)
 	{
 		VXM_PROFILE_FUNCTION();
+		if(HasScene()) DisconnectScene();
 		m_SceneHandle = std::move(scene);
+		if(!HasScene()) return;
+		LoadWorldSettings();
+		m_Resolver.ClearCache();
+		m_FixedTimeStep.Reset();
+		m_Snapshots.Clear();
+		ConnectScene();
 		// Integrate all Rigidbodies
 		auto func0 = [](entt::entity e, RigidbodyComponent& rc, TransformComponent& tc){
 			rc.SetTransform(&tc);
@@ -182,9 +736,82 @@ namespace Voxymore::Core
 
 	void RigidbodyPhysicsLayer::ResetScene()
 	{
+		VXM_PROFILE_FUNCTION();
+		if(HasScene()) DisconnectScene();
 		m_SceneHandle = nullptr;
 	}
 
+	void RigidbodyPhysicsLayer::LoadWorldSettings()
+	{
+		VXM_PROFILE_FUNCTION();
+		RigidbodyWorldComponent settings;
+		auto view = m_SceneHandle->view<RigidbodyWorldComponent>();
+		for (auto e : view)
+		{
+			settings = view.get<RigidbodyWorldComponent>(e);
+			break;
+		}
+
+		if(m_BroadPhase->GetType() != settings.BroadPhaseAlgorithm)
+		{
+			m_BroadPhase = BroadPhase::Create(settings.BroadPhaseAlgorithm);
+		}
+
+		m_Resolver.SetIterations(static_cast<uint32_t>(Math::Max(settings.SolverIterations, 1)));
+		m_Resolver.SetWarmStarting(settings.WarmStarting);
+
+		m_FixedTimeStep.SetFixedDeltaTime(settings.FixedDeltaTime > 0 ? settings.FixedDeltaTime : (Real)VXM_DEFAULT_FIXED_DELTA_TIME);
+		m_FixedTimeStep.SetMaxSubSteps(static_cast<uint32_t>(Math::Max(settings.MaxSubSteps, 1)));
+		m_Interpolate = settings.Interpolate;
+
+		m_AllowSleeping = settings.AllowSleeping;
+		m_SleepLinearVelocity = settings.SleepLinearVelocity;
+		m_SleepAngularVelocity = settings.SleepAngularVelocity;
+		m_TimeToSleep = settings.TimeToSleep;
+	}
+
+	BroadPhaseType RigidbodyPhysicsLayer::GetBroadPhaseType() const
+	{
+		return m_BroadPhase->GetType();
+	}
+
+	void RigidbodyPhysicsLayer::ConnectScene()
+	{
+		VXM_PROFILE_FUNCTION();
+		// The proxies are created lazily on the next broadphase, once the entity has all the required components.
+		m_BroadPhase->Clear();
+		m_Proxies.clear();
+		m_BoxManifolds.clear();
+		m_SceneHandle->on_destroy<ColliderComponent>().connect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_SceneHandle->on_destroy<RigidbodyComponent>().connect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_SceneHandle->on_construct<DisableComponent>().connect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_SceneHandle->on_construct<DisableRigidbody>().connect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+	}
+
+	void RigidbodyPhysicsLayer::DisconnectScene()
+	{
+		VXM_PROFILE_FUNCTION();
+		m_SceneHandle->on_destroy<ColliderComponent>().disconnect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_SceneHandle->on_destroy<RigidbodyComponent>().disconnect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_SceneHandle->on_construct<DisableComponent>().disconnect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_SceneHandle->on_construct<DisableRigidbody>().disconnect<&RigidbodyPhysicsLayer::OnRemoveProxy>(this);
+		m_BroadPhase->Clear();
+		m_Proxies.clear();
+		m_BoxManifolds.clear();
+		m_Snapshots.Clear();
+	}
+
+	void RigidbodyPhysicsLayer::OnRemoveProxy(entt::entity e)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Snapshots.Remove(e);
+		// The manifolds of the entity are keyed with its version and forgotten by UpdateManifolds on the next step.
+		auto it = m_Proxies.find(e);
+		if(it == m_Proxies.end()) return;
+		m_BroadPhase->DestroyProxy(it->second);
+		m_Proxies.erase(it);
+	}
+
 	bool RigidbodyPhysicsLayer::HasScene() const
 	{
 		return m_SceneHandle != nullptr;
@@ -13,12 +13,26 @@ namespace Voxymore::Core
 	void RigidbodySpringSystem::Update(Scene &scene, TimeStep ts)
 	{
 		VXM_PROFILE_FUNCTION();
-		auto func = [&](auto entity, RigidbodySpringComponent& asc, TransformComponent& tc)
+
+		// The springs read the transform of other entities, build the matrices of the anchors and the bodies they pull beforehand so the threads only read them.
+		auto view = scene.view<RigidbodySpringComponent, TransformComponent>(exclude<DisableComponent>);
+		for (auto entity : view)
+		{
+			view.get<TransformComponent>(entity).UpdateCache();
+			for (const auto& field : view.get<RigidbodySpringComponent>(entity).EntitiesConnected)
+			{
+				auto e = field.Entity.GetEntity(scene);
+				if(e && e.HasComponent<TransformComponent>()) e.GetComponent<TransformComponent>().UpdateCache();
+			}
+		}
+
+		// One spring pulls on many bodies, so the forces are recorded and applied once all the springs are computed.
+		auto func = [&](entt::entity entity, RigidbodySpringComponent& asc, TransformComponent& tc)
 		{
 			Vec3 anchorPos = tc.GetWorldPoint(asc.LocalPosition);
-			auto current = Entity(entity, &scene);
-			for(auto& field : asc.EntitiesConnected)
+			for(uint32_t i = 0; i < asc.EntitiesConnected.size(); ++i)
 			{
+				auto& field = asc.EntitiesConnected[i];
 				auto e = field.Entity.GetEntity(scene);
 				if(!e.HasComponent<RigidbodyComponent>()) continue;
 
@@ -26,15 +40,19 @@ namespace Voxymore::Core
 				Vec3 springForce = posE - anchorPos;
 				float magnitude = Math::Magnitude(springForce);
 				if(magnitude <= asc.RestLength) {
-					return;
+					continue;
 				}
 
 				float forceMagnitude = (asc.RestLength - magnitude) * asc.SpringConstant;
 
 				Vec3 force = Math::Normalize(springForce) * (forceMagnitude);
-				e.GetComponent<RigidbodyComponent>().AddForceAtPoint(force, posE);
+				m_Forces.AddForceAtPoint(entity, i, e, force, posE);
 			}
 		};
-		scene.each<RigidbodySpringComponent, TransformComponent>(exclude<DisableComponent>, func);
+		scene.each<RigidbodySpringComponent, TransformComponent>(exclude<DisableComponent>, MultiThreading::ExecutionPolicy::Parallel, func);
+
+		m_Forces.Reduce([&scene](const ForceAccumulator::ForceRecord& record) {
+			Entity(record.target, &scene).GetComponent<RigidbodyComponent>().AddForceAtPoint(record.force, record.point);
+		});
 	}
 } // namespace Voxymore::Core
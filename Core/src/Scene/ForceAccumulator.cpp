@@ -0,0 +1,65 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Scene/ForceAccumulator.hpp"
+#include <atomic>
+
+namespace Voxymore::Core
+{
+	namespace
+	{
+		std::atomic<uint64_t> s_NextAccumulatorId{1};
+
+		// The buffer of the last accumulator used by this thread.
+		thread_local uint64_t t_AccumulatorId = 0;
+		thread_local std::vector<ForceAccumulator::ForceRecord>* t_Buffer = nullptr;
+	}
+
+	ForceAccumulator::ForceAccumulator() : m_Id(s_NextAccumulatorId.fetch_add(1, std::memory_order_relaxed))
+	{
+	}
+
+	void ForceAccumulator::AddForce(entt::entity source, uint32_t order, entt::entity target, const Vec3& force)
+	{
+		GetLocalBuffer().push_back({target, source, order, force, Vec3(0), false});
+	}
+
+	void ForceAccumulator::AddForceAtPoint(entt::entity source, uint32_t order, entt::entity target, const Vec3& force, const Vec3& point)
+	{
+		GetLocalBuffer().push_back({target, source, order, force, point, true});
+	}
+
+	std::vector<ForceAccumulator::ForceRecord>& ForceAccumulator::GetLocalBuffer()
+	{
+		if(t_AccumulatorId != m_Id)
+		{
+			// First force emitted by this thread since it last used another accumulator.
+			// The buffers are kept between the updates, so each thread only allocates its own once.
+			std::unique_lock<std::mutex> lock(m_BuffersMutex);
+			auto& buffer = m_Buffers[std::this_thread::get_id()];
+			if(!buffer) buffer = std::make_unique<std::vector<ForceRecord>>();
+			t_Buffer = buffer.get();
+			t_AccumulatorId = m_Id;
+		}
+		return *t_Buffer;
+	}
+
+	void ForceAccumulator::Gather()
+	{
+		VXM_PROFILE_FUNCTION();
+		std::unique_lock<std::mutex> lock(m_BuffersMutex);
+		m_Sorted.clear();
+		for (auto& [thread, buffer] : m_Buffers)
+		{
+			m_Sorted.insert(m_Sorted.end(), buffer->begin(), buffer->end());
+			buffer->clear();
+		}
+
+		std::sort(m_Sorted.begin(), m_Sorted.end(), [](const ForceRecord& a, const ForceRecord& b) {
+			if(a.target != b.target) return entt::to_integral(a.target) < entt::to_integral(b.target);
+			if(a.source != b.source) return entt::to_integral(a.source) < entt::to_integral(b.source);
+			return a.order < b.order;
+		});
+	}
+} // namespace Voxymore::Core
@@ -6,6 +6,7 @@
 
 #include "Voxymore/Components/BSplinesComponents.hpp"
 #include "Voxymore/Components/BezierCurveComponent.hpp"
+#include "Voxymore/Components/CustomComponent.hpp"
 #include "Voxymore/Components/Components.hpp"
 #include "Voxymore/Components/GenericBezierCurve.hpp"
 #include "Voxymore/Components/LightComponent.hpp"
@@ -16,7 +17,6 @@
 #include "Voxymore/Renderer/Renderer.hpp"
 #include "Voxymore/Scene/Entity.hpp"
 #include "Voxymore/Scene/Scene.hpp"
-#include "Voxymore/Scene/SceneSerializer.hpp"
 #include "Voxymore/Scene/Systems.hpp"
 
 
@@ -39,14 +39,7 @@ namespace Voxymore::Core
 		VXM_PROFILE_FUNCTION();
 		Handle = scene->Handle;
 		InitScene();
-		// Copy the scene here, we want to retrieve each entity upon creation on this scene.
-		Path cacheScene = {FileSource::Cache, "./Scenes/"+std::to_string(scene->Handle)+".vxm"};
-		// Casting to Scene* for because I know I won't edit the scene on the serialize function but still need it as a raw non-const pointer.
-		SceneSerializer cacheSerializer(scene);
-		cacheSerializer.Serialize(cacheScene);
-		// Change target to deserialize the data to the current scene
-		cacheSerializer.ChangeSceneTarget(this);
-		cacheSerializer.Deserialize(cacheScene);
+		Clone(*scene);
 	}
 
 	Scene::Scene(const Scene &scene) : m_Name(scene.m_Name), m_ViewportHeight(scene.m_ViewportHeight), m_ViewportWidth(scene.m_ViewportWidth)
@@ -54,37 +47,70 @@ namespace Voxymore::Core
 		VXM_PROFILE_FUNCTION();
 		Handle = scene.Handle;
 		InitScene();
-
-		// Copy the scene here, we want to retrieve each entity upon creation on this scene.
-		Path cacheScene = {FileSource::Cache, "./Scenes/"+std::to_string(scene.Handle)+".vxm"};
-		// Casting to Scene* for because I know I won't edit the scene on the serialize function but still need it as a raw non-const pointer.
-		SceneSerializer cacheSerializer((Scene*)&scene);
-		cacheSerializer.Serialize(cacheScene);
-		// Change target to deserialize the data to the current scene
-		cacheSerializer.ChangeSceneTarget(this);
-		cacheSerializer.Deserialize(cacheScene);
+		Clone(scene);
 	}
 
 	Scene &Scene::operator=(const Scene & scene)
 	{
 		VXM_PROFILE_FUNCTION();
+		if(this == &scene) return *this;
 		Handle = scene.Handle;
 		m_Name = scene.m_Name;
 		m_ViewportHeight = scene.m_ViewportHeight;
 		m_ViewportWidth = scene.m_ViewportWidth;
-
-		// Copy the scene here, we want to retrieve each entity upon creation on this scene.
-		Path cacheScene = {FileSource::Cache, "./Scenes/"+std::to_string(scene.Handle)+".vxm"};
-		// Casting to Scene* for because I know I won't edit the scene on the serialize function but still need it as a raw non-const pointer.
-		SceneSerializer cacheSerializer((Scene*)&scene);
-		cacheSerializer.Serialize(cacheScene);
-		// Change target to deserialize the data to the current scene
-		cacheSerializer.ChangeSceneTarget(this);
-		cacheSerializer.Deserialize(cacheScene);
+		Clone(scene);
 
 		return *this;
 	}
 
+	void Scene::Clone(const Scene& source)
+	{
+		VXM_PROFILE_FUNCTION();
+		m_Registry.clear();
+
+		// Recreate the entities with the same handles, so each storage can be copied as is.
+		const auto entities = source.m_Registry.view<const IDComponent>();
+		for (auto it = entities.rbegin(); it != entities.rend(); ++it)
+		{
+			[[maybe_unused]] const entt::entity entity = m_Registry.create(*it);
+			VXM_CORE_ASSERT(entity == *it, "The entity {0} got the handle {1} in the copy of the scene.", static_cast<uint32_t>(*it), static_cast<uint32_t>(entity));
+		}
+
+		// The IDComponent fills m_Entities through OnCreateIDComponent.
+		CloneStorage<IDComponent>(source);
+		CloneStorage<TagComponent>(source);
+		CloneStorage<TransformComponent>(source);
+		CloneStorage<CameraComponent>(source);
+		CloneStorage<DisableComponent>(source);
+
+		for (const ComponentChecker& cc : ComponentManager::GetComponents())
+		{
+			if(cc.CloneComponents)
+			{
+				cc.CloneComponents(source, *this);
+				continue;
+			}
+
+			// The component cannot be copied, go through its serialization in memory.
+			// Casting to Scene* because I know I won't edit the scene on the serialize function but still need it as a raw non-const pointer.
+			for (auto it = entities.rbegin(); it != entities.rend(); ++it)
+			{
+				Entity sourceEntity(*it, (Scene*)&source);
+				if(!cc.HasComponent(sourceEntity)) continue;
+
+				YAML::Emitter out;
+				out << YAML::BeginMap;
+				cc.SerializeComponent(out, sourceEntity);
+				out << YAML::EndMap;
+
+				YAML::Node node = YAML::Load(out.c_str());
+				Entity targetEntity(*it, this);
+				cc.AddComponent(targetEntity);
+				cc.DeserializeComponent(node, targetEntity);
+			}
+		}
+	}
+
 	void Scene::InitScene()
 	{
 		VXM_PROFILE_FUNCTION();
@@ -466,6 +492,17 @@ namespace Voxymore::Core
 		return entity;
 	}
 
+	void Scene::ReserveEntities(size_t count)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto& entities = m_Registry.storage<entt::entity>();
+		entities.reserve(entities.size() + count);
+		ReserveStorage<IDComponent>(count);
+		ReserveStorage<TransformComponent>(count);
+		ReserveStorage<TagComponent>(count);
+		m_Entities.reserve(m_Entities.size() + count);
+	}
+
 	Entity Scene::GetEntity(UUID id)
 	{
 		VXM_PROFILE_FUNCTION();
@@ -10,10 +10,180 @@
 #include "Voxymore/Core/YamlHelper.hpp"
 #include "Voxymore/Scene/Entity.hpp"
 #include "Voxymore/Core/TypeHelpers.hpp"
-#include<ranges>
+#include "Voxymore/Core/BinaryStream.hpp"
+#include "Voxymore/Core/MappedFile.hpp"
+#include "Voxymore/Core/MultiThreading.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <ranges>
+#include <optional>
+#include <unordered_map>
 
 namespace Voxymore::Core
 {
+	namespace
+	{
+		/**
+		 * Layout of the runtime scene format, in the native endianness:
+		 *  - Header: magic, version, size of Real, scene name, entity count.
+		 *  - Entity table: one column per field (UUID, active, tag, position, rotation, euler rotation, scale).
+		 *  - Component type table: for each type, its name, encoding, entity count, and the offset and size of its block.
+		 *  - Component blocks: the indices of the entities in the entity table, then the data of each component.
+		 * The version must be increased whenever the layout or the binary data of a component changes.
+		 */
+		constexpr std::array<char, 4> s_RuntimeSceneMagic = {'V', 'X', 'M', 'S'};
+		constexpr uint32_t s_RuntimeSceneVersion = 1;
+		constexpr const char* s_CameraBlockName = "CameraComponent";
+
+		enum class RuntimeBlockEncoding : uint8_t
+		{
+			Binary = 0,
+			// The component didn't opt in the binary serialization, each component is a YAML document.
+			Yaml = 1,
+		};
+
+		struct RuntimeBlock
+		{
+			std::string Name;
+			RuntimeBlockEncoding Encoding;
+			std::vector<uint32_t> Indices;
+			BinaryWriter Data;
+		};
+
+		void SerializeCamera(BinaryWriter& out, const CameraComponent& component)
+		{
+			out.Write<uint8_t>(component.Primary);
+			out.Write<uint8_t>(component.FixedAspectRatio);
+			out.Write<uint8_t>(component.Camera.IsOrthographic());
+			out.Write(component.Camera.GetAspectRatio());
+			out.Write(component.Camera.GetOrthographicSize());
+			out.Write(component.Camera.GetOrthographicNear());
+			out.Write(component.Camera.GetOrthographicFar());
+			out.Write(component.Camera.GetPerspectiveVerticalFOV());
+			out.Write(component.Camera.GetPerspectiveNear());
+			out.Write(component.Camera.GetPerspectiveFar());
+		}
+
+		void DeserializeCamera(BinaryReader& in, CameraComponent& component)
+		{
+			component.Primary = in.Read<uint8_t>() != 0;
+			component.FixedAspectRatio = in.Read<uint8_t>() != 0;
+			bool isOrthographic = in.Read<uint8_t>() != 0;
+			component.Camera.SetAspectRatio(in.Read<float>());
+
+			auto orthographicSize = in.Read<float>();
+			auto orthographicNear = in.Read<float>();
+			auto orthographicFar = in.Read<float>();
+			component.Camera.SetOrthographic(orthographicSize, orthographicNear, orthographicFar);
+
+			auto perspectiveVerticalFOV = in.Read<float>();
+			auto perspectiveNear = in.Read<float>();
+			auto perspectiveFar = in.Read<float>();
+			component.Camera.SetPerspective(perspectiveVerticalFOV, perspectiveNear, perspectiveFar);
+
+			component.Camera.SwitchToOrthographic(isOrthographic);
+		}
+
+		void DeserializeTransform(const YAML::Node& node, TransformComponent& tc)
+		{
+			tc.SetPosition(node["Position"].as<glm::vec3>());
+			tc.SetScale(node["Scale"].as<glm::vec3>());
+			auto rotation = node["Rotation"].as<glm::quat>();
+			auto eulerRotation = node["EulerRotation"].as<glm::vec3>();
+			if (rotation != glm::quat(glm::radians(eulerRotation))) {
+				tc.SetRotation(rotation);
+			}
+			else {
+				tc.SetEulerRotation(eulerRotation);
+			}
+		}
+
+		void DeserializeCamera(const YAML::Node& node, CameraComponent& cc)
+		{
+			cc.Primary = node["Primary"].as<bool>();
+			cc.FixedAspectRatio = node["FixedAspectRatio"].as<bool>();
+
+			auto camera = node["Camera"];
+			auto aspectRatio = camera["AspectRatio"].as<float>();
+			cc.Camera.SetAspectRatio(aspectRatio);
+
+			auto orthographicSize = camera["OrthographicSize"].as<float>();
+			auto orthographicNear = camera["OrthographicNear"].as<float>();
+			auto orthographicFar = camera["OrthographicFar"].as<float>();
+			cc.Camera.SetOrthographic(orthographicSize, orthographicNear, orthographicFar);
+
+			auto perspectiveVerticalFOV = camera["PerspectiveVerticalFOV"].as<float>();
+			auto perspectiveNear = camera["PerspectiveNear"].as<float>();
+			auto perspectiveFar = camera["PerspectiveFar"].as<float>();
+			cc.Camera.SetPerspective(perspectiveVerticalFOV, perspectiveNear, perspectiveFar);
+
+			cc.Camera.SwitchToOrthographic(camera["IsOrthographic"].as<bool>());
+		}
+
+		/**
+		 * Number of entities parsed by a job and committed at once in the parallel loading.
+		 */
+		constexpr size_t s_DeserializationBatchSize = 1024;
+
+		/**
+		 * An entity read from the YAML document, ready to be added to the scene.
+		 */
+		struct ParsedEntity
+		{
+			// Not a UUID, as its default constructor draws a random number which isn't thread safe.
+			uint64_t Id = 0;
+			std::string Name;
+			bool Active = true;
+			std::optional<TransformComponent> Transform;
+			std::optional<CameraComponent> Camera;
+			/**
+			 * The index of each registered component of the entity and a deep copy of its node.
+			 * yaml-cpp creates nodes in the memory of the whole document when a missing key is accessed,
+			 * the copy keeps the deserialization of each component away from the memory shared with the other threads.
+			 */
+			std::vector<std::pair<uint32_t, YAML::Node>> Components;
+		};
+
+		/**
+		 * Only read the entity through const accesses, so the entities of a document can be parsed concurrently.
+		 */
+		ParsedEntity ParseEntity(const YAML::Node& yamlEntity, const std::vector<ComponentChecker>& components)
+		{
+			ParsedEntity parsed;
+			parsed.Id = yamlEntity["Entity"].as<uint64_t>();
+
+			const YAML::Node tagComponent = yamlEntity["TagComponent"];
+			parsed.Name = tagComponent ? tagComponent["Tag"].as<std::string>() : "Entity_" + std::to_string(parsed.Id);
+			parsed.Active = (!yamlEntity["IsActive"]) || yamlEntity["IsActive"].as<bool>();
+
+			const YAML::Node transformComponent = yamlEntity["TransformComponent"];
+			if (transformComponent) {
+				DeserializeTransform(transformComponent, parsed.Transform.emplace());
+			}
+
+			const YAML::Node cameraComponent = yamlEntity["CameraComponent"];
+			if (cameraComponent) {
+				DeserializeCamera(cameraComponent, parsed.Camera.emplace());
+			}
+
+			for (uint32_t i = 0; i < components.size(); ++i) {
+				const YAML::Node yamlcc = yamlEntity[components[i].ComponentName];
+				if (yamlcc) {
+					parsed.Components.emplace_back(i, YAML::Clone(yamlcc));
+				}
+			}
+			return parsed;
+		}
+
+		struct PendingComponent
+		{
+			const ComponentChecker* Checker;
+			Entity Target;
+			YAML::Node* Node;
+		};
+	} // namespace
+
 	SceneSerializer::SceneSerializer(const Ref<Scene> &scene) : m_Scene(scene)
 	{
 	}
@@ -86,6 +256,10 @@ namespace Voxymore::Core
 	bool SceneSerializer::Deserialize(const std::filesystem::path &filePath)
 	{
 		VXM_PROFILE_FUNCTION();
+		if (IsRuntimeScene(filePath)) {
+			return DeserializeRuntime(filePath);
+		}
+
 		std::ifstream ifstream(filePath);
 		std::stringstream stringstream;
 		stringstream << ifstream.rdbuf();
@@ -121,41 +295,12 @@ namespace Voxymore::Core
 
 				auto transformComponent = yamlEntity["TransformComponent"];
 				if (transformComponent) {
-					auto &tc = entity.GetComponent<TransformComponent>();
-					tc.SetPosition(transformComponent["Position"].as<glm::vec3>());
-					tc.SetScale(transformComponent["Scale"].as<glm::vec3>());
-					auto rotation = transformComponent["Rotation"].as<glm::quat>();
-					auto eulerRotation = transformComponent["EulerRotation"].as<glm::vec3>();
-					if (rotation != glm::quat(glm::radians(eulerRotation))) {
-						tc.SetRotation(rotation);
-					}
-					else {
-						tc.SetEulerRotation(eulerRotation);
-					}
+					DeserializeTransform(transformComponent, entity.GetComponent<TransformComponent>());
 				}
 
 				auto cameraComponent = yamlEntity["CameraComponent"];
 				if (cameraComponent) {
-					auto &cc = entity.AddComponent<CameraComponent>();
-
-					cc.Primary = cameraComponent["Primary"].as<bool>();
-					cc.FixedAspectRatio = cameraComponent["FixedAspectRatio"].as<bool>();
-
-					auto camera = cameraComponent["Camera"];
-					auto aspectRatio = camera["AspectRatio"].as<float>();
-					cc.Camera.SetAspectRatio(aspectRatio);
-
-					auto orthographicSize = camera["OrthographicSize"].as<float>();
-					auto orthographicNear = camera["OrthographicNear"].as<float>();
-					auto orthographicFar = camera["OrthographicFar"].as<float>();
-					cc.Camera.SetOrthographic(orthographicSize, orthographicNear, orthographicFar);
-
-					auto perspectiveVerticalFOV = camera["PerspectiveVerticalFOV"].as<float>();
-					auto perspectiveNear = camera["PerspectiveNear"].as<float>();
-					auto perspectiveFar = camera["PerspectiveFar"].as<float>();
-					cc.Camera.SetPerspective(perspectiveVerticalFOV, perspectiveNear, perspectiveFar);
-
-					cc.Camera.SwitchToOrthographic(camera["IsOrthographic"].as<bool>());
+					DeserializeCamera(cameraComponent, entity.AddComponent<CameraComponent>());
 				}
 
 				for (const ComponentChecker &cc: ComponentManager::GetComponents()) {
@@ -170,17 +315,392 @@ namespace Voxymore::Core
 		return true;
 	}
 
+	bool SceneSerializer::DeserializeParallel(const Path &filePath)
+	{
+		return DeserializeParallel(filePath.GetFullPath());
+	}
+
+	bool SceneSerializer::DeserializeParallel(const std::filesystem::path &filePath)
+	{
+		VXM_PROFILE_FUNCTION();
+		if (IsRuntimeScene(filePath)) {
+			return DeserializeRuntime(filePath);
+		}
+
+		std::ifstream ifstream(filePath);
+		std::stringstream stringstream;
+		stringstream << ifstream.rdbuf();
+
+		YAML::Node data = YAML::Load(stringstream.str());
+		YAML::Node sceneNode = data["Scene"];
+		if (!sceneNode) {
+			return false;
+		}
+
+		Scene& scene = GetScene();
+		scene.m_Name = sceneNode["Name"].as<std::string>();
+
+		auto entitiesNode = sceneNode["Entities"];
+		if (!entitiesNode) {
+			return true;
+		}
+
+		std::vector<YAML::Node> yamlEntities;
+		yamlEntities.reserve(entitiesNode.size());
+		for (YAML::Node yamlEntity : entitiesNode) {
+			yamlEntities.push_back(yamlEntity);
+		}
+
+		const std::vector<ComponentChecker>& components = ComponentManager::GetComponents();
+		const size_t batchCount = (yamlEntities.size() + s_DeserializationBatchSize - 1) / s_DeserializationBatchSize;
+
+		// Parse all the batches on the workers.
+		JobSystem& jobSystem = JobSystem::Get();
+		std::vector<std::vector<ParsedEntity>> batches(batchCount);
+		std::vector<JobHandle> jobs;
+		jobs.reserve(batchCount);
+		std::atomic<bool> failed{false};
+		for (size_t b = 0; b < batchCount; ++b) {
+			jobs.push_back(jobSystem.Schedule([&yamlEntities, &batches, &components, &failed, b]() {
+				const size_t begin = b * s_DeserializationBatchSize;
+				const size_t end = std::min(begin + s_DeserializationBatchSize, yamlEntities.size());
+				std::vector<ParsedEntity>& batch = batches[b];
+				batch.reserve(end - begin);
+				try {
+					for (size_t i = begin; i < end; ++i) {
+						batch.push_back(ParseEntity(yamlEntities[i], components));
+					}
+				}
+				catch (const std::exception& e) {
+					VXM_CORE_ERROR("Couldn't parse an entity: {0}", e.what());
+					failed.store(true, std::memory_order_relaxed);
+				}
+			}));
+		}
+
+		scene.ReserveEntities(yamlEntities.size());
+
+		// Commit the batches in order on this thread while the next ones are still being parsed.
+		std::vector<size_t> componentCounts(components.size());
+		std::vector<Entity> entities;
+		std::vector<PendingComponent> concurrentComponents;
+		// An exception must not leave the scope while jobs still reference the local variables.
+		try {
+			for (size_t b = 0; b < batchCount; ++b) {
+				jobSystem.WaitFor(jobs[b]);
+				if (failed.load(std::memory_order_relaxed)) {
+					jobSystem.WaitFor(jobs);
+					return false;
+				}
+
+				std::vector<ParsedEntity>& batch = batches[b];
+
+				std::fill(componentCounts.begin(), componentCounts.end(), 0);
+				for (const ParsedEntity& parsed : batch) {
+					for (const auto& [index, node] : parsed.Components) {
+						++componentCounts[index];
+					}
+				}
+				for (uint32_t i = 0; i < components.size(); ++i) {
+					if (componentCounts[i]) components[i].ReserveComponents(scene, componentCounts[i]);
+				}
+
+				entities.clear();
+				for (const ParsedEntity& parsed : batch) {
+					Entity entity = scene.CreateEntity(UUID(parsed.Id), parsed.Name);
+					entity.SetActive(parsed.Active);
+					if (parsed.Transform) entity.GetComponent<TransformComponent>() = *parsed.Transform;
+					if (parsed.Camera) entity.AddComponent<CameraComponent>(*parsed.Camera);
+					for (const auto& [index, node] : parsed.Components) {
+						components[index].AddComponent(entity);
+					}
+					entities.push_back(entity);
+				}
+
+				// The components which may add or remove components are deserialized here, in the order of the sequential loading.
+				concurrentComponents.clear();
+				for (size_t i = 0; i < batch.size(); ++i) {
+					for (auto& [index, node] : batch[i].Components) {
+						const ComponentChecker& cc = components[index];
+						if (cc.ConcurrentDeserialization) {
+							concurrentComponents.push_back({&cc, entities[i], &node});
+						}
+						else {
+							cc.DeserializeComponent(node, entities[i]);
+						}
+					}
+				}
+
+				// The registry doesn't change anymore, the other components only write in themselves.
+				MultiThreading::for_each(MultiThreading::ExecutionPolicy::Parallel, concurrentComponents.begin(), concurrentComponents.end(), [](PendingComponent& pending) {
+					pending.Checker->DeserializeComponent(*pending.Node, pending.Target);
+				});
+
+				// Release the batch as soon as it is committed.
+				std::vector<ParsedEntity>().swap(batch);
+			}
+		}
+		catch (const std::exception& e) {
+			VXM_CORE_ERROR("Couldn't deserialize the scene '{0}': {1}", filePath.string(), e.what());
+			jobSystem.WaitFor(jobs);
+			return false;
+		}
+
+		VXM_CORE_TRACE("Deserialized {0} entities in {1} batches from '{2}'.", yamlEntities.size(), batchCount, filePath.string());
+		return true;
+	}
+
+	bool SceneSerializer::SerializeRuntime(const Path &filePath) const
+	{
+		return SerializeRuntime(filePath.GetFullPath());
+	}
+
 	bool SceneSerializer::SerializeRuntime(const std::filesystem::path &filePath) const
 	{
 		VXM_PROFILE_FUNCTION();
-		return false;
+		const Scene& scene = GetScene();
+		Scene* ptr = std::visit<Scene*>(overloads{[](Scene* s){return s;}, [](Ref<Scene> s){return s.get();}}, m_Scene);
+
+		std::vector<Entity> entities;
+		entities.reserve(scene.m_Registry.storage<entt::entity>()->size());
+		for (entt::entity id : *scene.m_Registry.storage<entt::entity>()) {
+			Entity entity(id, ptr);
+			if (!entity || !scene.m_Registry.valid(entity)) continue;
+			entities.push_back(entity);
+		}
+
+		BinaryWriter out;
+		out.WriteBytes(s_RuntimeSceneMagic.data(), s_RuntimeSceneMagic.size());
+		out.Write(s_RuntimeSceneVersion);
+		out.Write<uint32_t>(sizeof(Real));
+		out.WriteString(scene.m_Name);
+		out.Write<uint32_t>(static_cast<uint32_t>(entities.size()));
+
+		// Entity table, one column per field.
+		static const TransformComponent s_DefaultTransform;
+		auto getTransform = [](Entity e) -> const TransformComponent& { return e.HasComponent<TransformComponent>() ? e.GetComponent<TransformComponent>() : s_DefaultTransform; };
+		for (Entity e : entities) out.Write<uint64_t>(e.id());
+		for (Entity e : entities) out.Write<uint8_t>(e.IsActive());
+		for (Entity e : entities) out.WriteString(e.HasComponent<TagComponent>() ? e.GetComponent<TagComponent>().Tag : std::string());
+		for (Entity e : entities) out.Write(getTransform(e).GetPosition());
+		for (Entity e : entities) out.Write(getTransform(e).GetRotation());
+		for (Entity e : entities) out.Write(getTransform(e).GetEulerRotation());
+		for (Entity e : entities) out.Write(getTransform(e).GetScale());
+
+		// One block per component type, holding the index of the entities owning the component then their data.
+		std::vector<RuntimeBlock> blocks;
+		{
+			RuntimeBlock camera{s_CameraBlockName, RuntimeBlockEncoding::Binary};
+			for (uint32_t i = 0; i < entities.size(); ++i) {
+				if (!entities[i].HasComponent<CameraComponent>()) continue;
+				camera.Indices.push_back(i);
+				SerializeCamera(camera.Data, entities[i].GetComponent<CameraComponent>());
+			}
+			if (!camera.Indices.empty()) blocks.push_back(std::move(camera));
+		}
+
+		for (const ComponentChecker &cc: ComponentManager::GetComponents()) {
+			RuntimeBlock block{cc.ComponentName, cc.SerializeBinary ? RuntimeBlockEncoding::Binary : RuntimeBlockEncoding::Yaml};
+			for (uint32_t i = 0; i < entities.size(); ++i) {
+				if (!cc.HasComponent(entities[i])) continue;
+				block.Indices.push_back(i);
+				if (cc.SerializeBinary) {
+					cc.SerializeBinary(block.Data, entities[i]);
+				}
+				else {
+					YAML::Emitter emitter;
+					emitter << YAML::BeginMap;
+					cc.SerializeComponent(emitter, entities[i]);
+					emitter << YAML::EndMap;
+					block.Data.WriteString(emitter.c_str());
+				}
+			}
+			if (!block.Indices.empty()) blocks.push_back(std::move(block));
+		}
+
+		// Component type table, the offsets are filled once the blocks are written.
+		out.Write<uint32_t>(static_cast<uint32_t>(blocks.size()));
+		std::vector<size_t> offsets;
+		offsets.reserve(blocks.size());
+		for (const RuntimeBlock& block : blocks) {
+			out.WriteString(block.Name);
+			out.Write(block.Encoding);
+			out.Write<uint32_t>(static_cast<uint32_t>(block.Indices.size()));
+			offsets.push_back(out.Reserve<uint64_t>());
+			out.Write<uint64_t>(block.Indices.size() * sizeof(uint32_t) + block.Data.size());
+		}
+
+		for (size_t i = 0; i < blocks.size(); ++i) {
+			out.WriteAt<uint64_t>(offsets[i], out.size());
+			out.WriteArray(std::span<const uint32_t>(blocks[i].Indices));
+			out.WriteBytes(blocks[i].Data.GetBuffer().data(), blocks[i].Data.size());
+		}
+
+		return out.WriteToFile(filePath);
+	}
+
+	bool SceneSerializer::DeserializeRuntime(const Path &filePath, bool deserializeId)
+	{
+		return DeserializeRuntime(filePath.GetFullPath(), deserializeId);
 	}
 
 	bool SceneSerializer::DeserializeRuntime(const std::filesystem::path &filePath, bool deserializeId)
 	{
 		VXM_PROFILE_FUNCTION();
-		VXM_CORE_ASSERT(false, "Function DeserializeRuntime not implemented yet.");
-		return false;
+		MappedFile file(filePath);
+		if (!file) {
+			VXM_CORE_ERROR("Couldn't open the scene '{0}'.", filePath.string());
+			return false;
+		}
+
+		BinaryReader in(file.As<uint8_t>());
+		std::array<char, 4> magic{};
+		in.ReadBytes(magic.data(), magic.size());
+		if (magic != s_RuntimeSceneMagic) {
+			VXM_CORE_ERROR("The file '{0}' is not a runtime scene.", filePath.string());
+			return false;
+		}
+
+		auto version = in.Read<uint32_t>();
+		if (version != s_RuntimeSceneVersion) {
+			VXM_CORE_ERROR("The scene '{0}' has the version {1} while the version {2} is expected, it must be cooked again.", filePath.string(), version, s_RuntimeSceneVersion);
+			return false;
+		}
+
+		auto realSize = in.Read<uint32_t>();
+		if (realSize != sizeof(Real)) {
+			VXM_CORE_ERROR("The scene '{0}' was cooked with {1} bytes reals while the engine uses {2} bytes reals.", filePath.string(), realSize, sizeof(Real));
+			return false;
+		}
+
+		std::string name = in.ReadString();
+		auto count = in.Read<uint32_t>();
+		// Each entity takes at least a byte, which protects the allocations against a corrupted count.
+		if (!in.IsValid() || count > in.Remaining()) {
+			VXM_CORE_ERROR("The scene '{0}' is corrupted.", filePath.string());
+			return false;
+		}
+
+		std::vector<uint64_t> ids(count);
+		std::vector<uint8_t> actives(count);
+		std::vector<std::string> tags(count);
+		std::vector<Vec3> positions(count);
+		std::vector<Quat> rotations(count);
+		std::vector<Vec3> eulerRotations(count);
+		std::vector<Vec3> scales(count);
+		in.ReadArray(std::span<uint64_t>(ids));
+		in.ReadArray(std::span<uint8_t>(actives));
+		for (std::string& tag : tags) tag = in.ReadString();
+		in.ReadArray(std::span<Vec3>(positions));
+		in.ReadArray(std::span<Quat>(rotations));
+		in.ReadArray(std::span<Vec3>(eulerRotations));
+		in.ReadArray(std::span<Vec3>(scales));
+		if (!in.IsValid()) {
+			VXM_CORE_ERROR("The scene '{0}' is corrupted.", filePath.string());
+			return false;
+		}
+
+		Scene& scene = GetScene();
+		scene.m_Name = name;
+
+		std::vector<Entity> entities;
+		entities.reserve(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			std::string tag = tags[i].empty() ? "Entity_" + std::to_string(ids[i]) : tags[i];
+			Entity entity = deserializeId ? scene.CreateEntity(UUID(ids[i]), tag) : scene.CreateEntity(tag);
+			entity.SetActive(actives[i]);
+
+			auto &tc = entity.GetComponent<TransformComponent>();
+			tc.SetPosition(positions[i]);
+			tc.SetScale(scales[i]);
+			if (rotations[i] != Quat(glm::radians(eulerRotations[i]))) {
+				tc.SetRotation(rotations[i]);
+			}
+			else {
+				tc.SetEulerRotation(eulerRotations[i]);
+			}
+			entities.push_back(entity);
+		}
+
+		std::unordered_map<std::string, const ComponentChecker*> components;
+		for (const ComponentChecker &cc: ComponentManager::GetComponents()) {
+			components[cc.ComponentName] = &cc;
+		}
+
+		bool valid = true;
+		auto blockCount = in.Read<uint32_t>();
+		for (uint32_t b = 0; b < blockCount && in.IsValid(); ++b) {
+			std::string blockName = in.ReadString();
+			auto encoding = in.Read<RuntimeBlockEncoding>();
+			auto entityCount = in.Read<uint32_t>();
+			auto offset = in.Read<uint64_t>();
+			auto size = in.Read<uint64_t>();
+
+			BinaryReader block = in.SubReader(offset, size);
+			if (entityCount > block.Remaining() / sizeof(uint32_t)) {
+				VXM_CORE_ERROR("The block '{0}' of the scene '{1}' is corrupted.", blockName, filePath.string());
+				valid = false;
+				continue;
+			}
+			std::vector<uint32_t> indices(entityCount);
+			block.ReadArray(std::span<uint32_t>(indices));
+			if (std::any_of(indices.begin(), indices.end(), [count](uint32_t index) { return index >= count; })) {
+				VXM_CORE_ERROR("The block '{0}' of the scene '{1}' is corrupted.", blockName, filePath.string());
+				valid = false;
+				continue;
+			}
+
+			if (blockName == s_CameraBlockName) {
+				for (uint32_t index : indices) {
+					DeserializeCamera(block, entities[index].AddComponent<CameraComponent>());
+				}
+			}
+			else {
+				auto it = components.find(blockName);
+				if (it == components.end()) {
+					VXM_CORE_WARNING("The component '{0}' of the scene '{1}' is not registered, it is skipped.", blockName, filePath.string());
+					continue;
+				}
+				const ComponentChecker& cc = *it->second;
+
+				if (encoding == RuntimeBlockEncoding::Binary) {
+					if (!cc.DeserializeBinary) {
+						VXM_CORE_ERROR("The component '{0}' was cooked in binary but cannot be read from binary anymore, the scene '{1}' must be cooked again.", blockName, filePath.string());
+						valid = false;
+						continue;
+					}
+					for (uint32_t index : indices) {
+						cc.AddComponent(entities[index]);
+						cc.DeserializeBinary(block, entities[index]);
+					}
+				}
+				else {
+					for (uint32_t index : indices) {
+						std::string text = block.ReadString();
+						if (!block.IsValid()) break;
+						YAML::Node node = YAML::Load(text);
+						cc.AddComponent(entities[index]);
+						cc.DeserializeComponent(node, entities[index]);
+					}
+				}
+			}
+
+			if (!block.IsValid()) {
+				VXM_CORE_ERROR("The block '{0}' of the scene '{1}' is corrupted.", blockName, filePath.string());
+				valid = false;
+			}
+		}
+
+		return valid && in.IsValid();
+	}
+
+	bool SceneSerializer::IsRuntimeScene(const std::filesystem::path &filePath)
+	{
+		VXM_PROFILE_FUNCTION();
+		std::ifstream file(filePath, std::ios::binary);
+		std::array<char, 4> magic{};
+		file.read(magic.data(), magic.size());
+		return file && magic == s_RuntimeSceneMagic;
 	}
 
 	void SceneSerializer::SerializeEntity(YAML::Emitter &out, Entity entity)
@@ -0,0 +1,79 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+#include "Voxymore/Scene/TransformSnapshots.hpp"
+
+namespace Voxymore::Core
+{
+	void TransformSnapshots::Restore(entt::entity entity, TransformComponent& transform)
+	{
+		VXM_PROFILE_FUNCTION();
+		auto it = m_Snapshots.find(entity);
+		if(it == m_Snapshots.end())
+		{
+			Vec3 position = transform.GetPosition();
+			Quat rotation = transform.GetRotation();
+			m_Snapshots[entity] = {position, rotation, position, rotation, position, rotation};
+			return;
+		}
+
+		Snapshot& snapshot = it->second;
+		if(transform.GetPosition() != snapshot.renderedPosition || transform.GetRotation() != snapshot.renderedRotation)
+		{
+			// Moved by someone else since the last frame, the new pose is the simulated one and isn't interpolated.
+			snapshot.currentPosition = snapshot.previousPosition = snapshot.renderedPosition = transform.GetPosition();
+			snapshot.currentRotation = snapshot.previousRotation = snapshot.renderedRotation = transform.GetRotation();
+			return;
+		}
+
+		transform.SetPosition(snapshot.currentPosition);
+		transform.SetRotation(snapshot.currentRotation);
+	}
+
+	void TransformSnapshots::SavePrevious(entt::entity entity, const TransformComponent& transform)
+	{
+		SavePrevious(entity, transform.GetPosition(), transform.GetRotation());
+	}
+
+	void TransformSnapshots::SavePrevious(entt::entity entity, const Vec3& position, const Quat& rotation)
+	{
+		Snapshot& snapshot = m_Snapshots[entity];
+		snapshot.previousPosition = position;
+		snapshot.previousRotation = rotation;
+	}
+
+	void TransformSnapshots::SaveCurrent(entt::entity entity, const TransformComponent& transform)
+	{
+		SaveCurrent(entity, transform.GetPosition(), transform.GetRotation());
+	}
+
+	void TransformSnapshots::SaveCurrent(entt::entity entity, const Vec3& position, const Quat& rotation)
+	{
+		Snapshot& snapshot = m_Snapshots[entity];
+		snapshot.currentPosition = position;
+		snapshot.currentRotation = rotation;
+	}
+
+	void TransformSnapshots::Interpolate(entt::entity entity, TransformComponent& transform, Real alpha)
+	{
+		auto it = m_Snapshots.find(entity);
+		if(it == m_Snapshots.end()) return;
+
+		Snapshot& snapshot = it->second;
+		snapshot.renderedPosition = glm::mix(snapshot.previousPosition, snapshot.currentPosition, alpha);
+		snapshot.renderedRotation = glm::slerp(snapshot.previousRotation, snapshot.currentRotation, alpha);
+		transform.SetPosition(snapshot.renderedPosition);
+		transform.SetRotation(snapshot.renderedRotation);
+	}
+
+	void TransformSnapshots::Remove(entt::entity entity)
+	{
+		m_Snapshots.erase(entity);
+	}
+
+	void TransformSnapshots::Clear()
+	{
+		m_Snapshots.clear();
+	}
+} // namespace Voxymore::Core
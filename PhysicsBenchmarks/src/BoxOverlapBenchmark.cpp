@@ -0,0 +1,159 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+// Test the same random box pairs for overlap with IntersectionDetector::BoxAndBox, one pair at a time,
+// and with a BoxOverlapBatch for each instruction set supported by the CPU, and report:
+//  - the best time of each implementation over the runs and its speedup against the pair by pair test,
+//  - the number of pairs where the implementation doesn't agree with the pair by pair test.
+//
+// Usage: BoxOverlapBenchmark [--pairs N] [--runs N] [--seed N]
+// Without --pairs, the benchmark runs on 1000, 10000 and 100000 pairs.
+
+#include "Voxymore/Voxymore.hpp"
+#include "Voxymore/RigidbodiesPhysics/Primitive.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/BoxOverlapBatch.hpp"
+#include "Voxymore/RigidbodiesPhysics/Collisions/CollisionDetector.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Voxymore::Core;
+
+namespace
+{
+	struct BenchmarkParameters
+	{
+		std::vector<size_t> pairs = {1000, 10000, 100000};
+		uint32_t runs = 20;
+		uint32_t seed = 42;
+	};
+
+	bool ParseArguments(int argc, char** argv, BenchmarkParameters& parameters)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+			if(argument == "--pairs" && hasValue) parameters.pairs = {static_cast<size_t>(std::stoull(argv[++i]))};
+			else if(argument == "--runs" && hasValue) parameters.runs = std::max(1u, static_cast<uint32_t>(std::stoul(argv[++i])));
+			else if(argument == "--seed" && hasValue) parameters.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+			else return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Boxes of random size and orientation, spread so that about half of the pairs overlap.
+	 */
+	struct BoxSet
+	{
+		std::vector<TransformComponent> transforms;
+		std::vector<Box> boxes;
+
+		BoxSet(size_t count, std::mt19937& random)
+		{
+			std::uniform_real_distribution<Real> position(-1.5, 1.5);
+			std::uniform_real_distribution<Real> angle(-180, 180);
+			std::uniform_real_distribution<Real> size(.25, 1);
+
+			transforms.resize(count);
+			boxes.resize(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				transforms[i].SetPosition({position(random), position(random), position(random)});
+				transforms[i].SetEulerRotation({angle(random), angle(random), angle(random)});
+				boxes[i].m_HalfSize = {size(random), size(random), size(random)};
+				boxes[i].m_Transform = &transforms[i];
+				boxes[i].CacheMatrix();
+			}
+		}
+	};
+
+	template<typename Func>
+	double Best(uint32_t runs, Func&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (uint32_t r = 0; r < runs; ++r)
+		{
+			const auto begin = std::chrono::steady_clock::now();
+			func();
+			best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+		}
+		return best;
+	}
+
+	const char* GetName(SimdLevel level)
+	{
+		switch (level)
+		{
+			case SimdLevel::AVX2: return "AVX2";
+			case SimdLevel::SSE4: return "SSE4.1";
+			default: return "Scalar";
+		}
+	}
+
+	void Run(size_t count, const BenchmarkParameters& parameters)
+	{
+		std::mt19937 random(parameters.seed);
+		BoxSet one(count, random);
+		BoxSet two(count, random);
+
+		std::vector<uint8_t> reference(count);
+		const double pairByPair = Best(parameters.runs, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				reference[i] = IntersectionDetector::BoxAndBox(one.boxes[i], two.boxes[i]) ? 1 : 0;
+			}
+		});
+
+		BoxOverlapBatch batch;
+		batch.Reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			batch.Add(one.boxes[i], two.boxes[i]);
+		}
+
+		const size_t overlaps = std::count(reference.begin(), reference.end(), 1);
+		std::printf("%zu pairs, %zu overlapping, best of %u runs:\n", count, overlaps, parameters.runs);
+		std::printf("  %-14s %10.3f ms\n", "Pair by pair", pairByPair * 1000.0);
+
+		for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE4, SimdLevel::AVX2})
+		{
+			if(static_cast<int>(level) > static_cast<int>(BoxOverlapBatch::GetSupportedSimdLevel())) continue;
+			batch.SetSimdLevel(level);
+			const double time = Best(parameters.runs, [&]() { batch.Test(); });
+
+			const std::vector<uint8_t>& results = batch.Test();
+			size_t disagreements = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				if(results[i] != reference[i]) ++disagreements;
+			}
+			std::printf("  %-14s %10.3f ms  x%.2f  %zu disagreements\n", GetName(level), time * 1000.0, pairByPair / time, disagreements);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkParameters parameters;
+	if(!ParseArguments(argc, argv, parameters))
+	{
+		std::printf("Usage: %s [--pairs N] [--runs N] [--seed N]\n", argc > 0 ? argv[0] : "BoxOverlapBenchmark");
+		return 1;
+	}
+
+	Log::Init();
+
+	for (size_t count : parameters.pairs)
+	{
+		Run(count, parameters);
+	}
+	return 0;
+}
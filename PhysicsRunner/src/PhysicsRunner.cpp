@@ -0,0 +1,205 @@
+//
+// Created by ianpo on 18/10/2026.
+//
+
+// Load a scene, step the physics layers a fixed number of times without any window, and report:
+//  - the time spent in each phase and the number of contacts,
+//  - a hash of the final state of the bodies, identical between two runs if the simulation is deterministic.
+//
+// Usage: PhysicsRunner <scene.vxm_scn> [--steps N] [--dt seconds] [--layers all|rigidbody|particle] [--project Project.vxm]
+
+#include "Voxymore/Voxymore.hpp"
+#include "Voxymore/Project/Project.hpp"
+#include "Voxymore/Scene/SceneSerializer.hpp"
+#include "Voxymore/ParticlesPhysics/ParticlePhysicsLayer.hpp"
+#include "Voxymore/ParticlesPhysics/Components/ParticleComponent.hpp"
+#include "Voxymore/RigidbodiesPhysics/RigidbodyPhysicsLayer.hpp"
+#include "Voxymore/RigidbodiesPhysics/Components/RigidbodyComponent.hpp"
+#include <sha256.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Voxymore::Core;
+
+namespace
+{
+	struct RunnerParameters
+	{
+		std::filesystem::path scene;
+		std::filesystem::path project;
+		uint32_t steps = 600;
+		// Negative to keep the one of the scene.
+		double dt = -1;
+		bool rigidbodies = true;
+		bool particles = true;
+	};
+
+	bool ParseArguments(int argc, char** argv, RunnerParameters& parameters)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+			if(argument == "--steps" && hasValue) parameters.steps = static_cast<uint32_t>(std::stoul(argv[++i]));
+			else if(argument == "--dt" && hasValue) parameters.dt = std::stod(argv[++i]);
+			else if(argument == "--project" && hasValue) parameters.project = argv[++i];
+			else if(argument == "--layers" && hasValue)
+			{
+				std::string layers = argv[++i];
+				parameters.rigidbodies = layers == "all" || layers == "rigidbody";
+				parameters.particles = layers == "all" || layers == "particle";
+			}
+			else if(parameters.scene.empty() && !argument.starts_with("--")) parameters.scene = argument;
+			else return false;
+		}
+		return !parameters.scene.empty();
+	}
+
+	template<typename T>
+	void AddToHash(SHA256& sha256, const T& value)
+	{
+		sha256.add(&value, sizeof(T));
+	}
+
+	/**
+	 * @brief Hash the transform and velocities of every entity, in the order of their UUID so the registry order doesn't matter.
+	 */
+	std::string HashState(const Ref<Scene>& scene)
+	{
+		VXM_PROFILE_FUNCTION();
+		std::vector<std::pair<uint64_t, entt::entity>> entities;
+		auto view = scene->view<TransformComponent>();
+		for (entt::entity e : view)
+		{
+			entities.emplace_back(static_cast<uint64_t>(Entity(e, scene.get()).id()), e);
+		}
+		std::sort(entities.begin(), entities.end());
+
+		SHA256 sha256;
+		for (auto [uuid, e] : entities)
+		{
+			Entity entity(e, scene.get());
+			const TransformComponent& tc = entity.GetComponent<TransformComponent>();
+			AddToHash(sha256, uuid);
+			AddToHash(sha256, tc.GetPosition());
+			AddToHash(sha256, tc.GetRotation());
+			AddToHash(sha256, tc.GetScale());
+
+			if(entity.HasComponent<RigidbodyComponent>())
+			{
+				const RigidbodyComponent& rc = entity.GetComponent<RigidbodyComponent>();
+				AddToHash(sha256, rc.GetLinearVelocity());
+				AddToHash(sha256, rc.GetAngularVelocity());
+			}
+
+			if(entity.HasComponent<ParticleComponent>())
+			{
+				const ParticleComponent& pc = entity.GetComponent<ParticleComponent>();
+				AddToHash(sha256, pc.GetPosition());
+				AddToHash(sha256, pc.GetVelocity());
+			}
+		}
+		return sha256.getHash();
+	}
+
+	double ToMilliseconds(double seconds)
+	{
+		return seconds * 1000.0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	RunnerParameters parameters;
+	if(!ParseArguments(argc, argv, parameters))
+	{
+		std::printf("Usage: %s <scene.vxm_scn> [--steps N] [--dt seconds] [--layers all|rigidbody|particle] [--project Project.vxm]\n", argc > 0 ? argv[0] : "PhysicsRunner");
+		return 1;
+	}
+
+	Log::Init();
+
+	if(!parameters.project.empty() && !Project::Load(parameters.project))
+	{
+		VXM_CORE_ERROR("Couldn't load the project '{0}'.", parameters.project.string());
+		return 1;
+	}
+
+	// Attached first as they register the physics components the scene needs to be deserialized.
+	RigidbodyPhysicsLayer rigidbodyLayer;
+	ParticlePhysicsLayer particleLayer;
+	rigidbodyLayer.OnAttach();
+	particleLayer.OnAttach();
+
+	Ref<Scene> scene = CreateRef<Scene>();
+	SceneSerializer serializer(scene);
+	if(!serializer.Deserialize(parameters.scene))
+	{
+		VXM_CORE_ERROR("Couldn't load the scene '{0}'.", parameters.scene.string());
+		return 1;
+	}
+	scene->StartScene();
+
+	if(parameters.rigidbodies)
+	{
+		rigidbodyLayer.SetScene(scene);
+		rigidbodyLayer.SetInterpolation(false);
+		if(parameters.dt > 0) rigidbodyLayer.GetFixedTimeStep().SetFixedDeltaTime(parameters.dt);
+	}
+	if(parameters.particles)
+	{
+		particleLayer.SetScene(scene);
+		particleLayer.SetInterpolation(false);
+		if(parameters.dt > 0) particleLayer.GetFixedTimeStep().SetFixedDeltaTime(parameters.dt);
+	}
+
+	// One step per frame, the systems adding their forces before each of them like in the editor.
+	const auto begin = std::chrono::steady_clock::now();
+	const TimeStep dt = parameters.rigidbodies ? rigidbodyLayer.GetFixedTimeStep().GetFixedDeltaTime() : particleLayer.GetFixedTimeStep().GetFixedDeltaTime();
+	for (uint32_t i = 0; i < parameters.steps; ++i)
+	{
+		for (Ref<System>& system : SystemManager::GetSystems(scene->Handle))
+		{
+			if(SystemManager::IsActive(system->GetName())) system->Update(*scene, dt);
+		}
+		if(parameters.particles) particleLayer.Simulate(1);
+		if(parameters.rigidbodies) rigidbodyLayer.Simulate(1);
+	}
+	const double total = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	std::printf("Scene: %s\n", parameters.scene.string().c_str());
+	std::printf("Steps: %u, dt: %f s, total: %.3f ms\n", parameters.steps, (double)dt.GetSeconds(), ToMilliseconds(total));
+
+	if(parameters.rigidbodies)
+	{
+		const RigidbodyPhysicsStats& stats = rigidbodyLayer.GetStats();
+		std::printf("Rigidbodies:\n");
+		std::printf("  integrate:   %10.3f ms\n", ToMilliseconds(stats.integrate));
+		std::printf("  broadphase:  %10.3f ms\n", ToMilliseconds(stats.broadphase));
+		std::printf("  narrowphase: %10.3f ms\n", ToMilliseconds(stats.narrowphase));
+		std::printf("  resolve:     %10.3f ms\n", ToMilliseconds(stats.resolve));
+		std::printf("  potential contacts: %llu, contacts: %llu\n", (unsigned long long)stats.potentialContacts, (unsigned long long)stats.contacts);
+	}
+
+	if(parameters.particles)
+	{
+		const ParticlePhysicsStats& stats = particleLayer.GetStats();
+		std::printf("Particles:\n");
+		std::printf("  integrate:   %10.3f ms\n", ToMilliseconds(stats.integrate));
+		std::printf("  resolve:     %10.3f ms\n", ToMilliseconds(stats.resolve));
+		std::printf("  contacts: %llu\n", (unsigned long long)stats.contacts);
+	}
+
+	std::printf("State hash: %s\n", HashState(scene).c_str());
+
+	scene->StopScene();
+	rigidbodyLayer.ResetScene();
+	particleLayer.ResetScene();
+	rigidbodyLayer.OnDetach();
+	particleLayer.OnDetach();
+	return 0;
+}